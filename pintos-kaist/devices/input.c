@@ -1,48 +1,117 @@
-#include "devices/input.h"
-#include <debug.h>
-#include "devices/intq.h"
-#include "devices/serial.h"
-
-/* Stores keys from the keyboard and serial port. */
-static struct intq buffer;
-
-/* Initializes the input buffer. */
-void
-input_init (void) {
-	intq_init (&buffer);
-}
-
-/* 입력 버퍼에 키를 추가한다.
-인터럽트는 꺼져 있어야 하며, 버퍼는 가득 차 있지 않아야 한다. */
-void
-input_putc (uint8_t key) {
-	ASSERT (intr_get_level () == INTR_OFF);
-	ASSERT (!intq_full (&buffer));
-
-	intq_putc (&buffer, key);
-	serial_notify ();
-}
-
-/* 입력 버퍼에서 키를 하나 가져온다.
-   버퍼가 비어 있으면 키가 입력될 때까지 대기한다. */
-uint8_t
-input_getc (void) {
-	enum intr_level old_level;
-	uint8_t key;
-
-	old_level = intr_disable ();
-	key = intq_getc (&buffer);
-	serial_notify ();
-	intr_set_level (old_level);
-
-	return key;
-}
-
-/* Returns true if the input buffer is full,
-   false otherwise.
-   Interrupts must be off. */
-bool
-input_full (void) {
-	ASSERT (intr_get_level () == INTR_OFF);
-	return intq_full (&buffer);
-}
+#include "devices/input.h"
+#include <debug.h>
+#include <ringbuf.h>
+#include "devices/serial.h"
+#include "threads/interrupt.h"
+#include "threads/synch.h"
+#include "threads/waitq.h"
+
+/* Input buffer size, in keys. */
+#define INPUT_BUFSIZE 64
+
+/* Stores keys from the keyboard and serial port.  Their interrupt
+   handlers never run at once, so the ring has a single producer. */
+static struct ringbuf buffer;
+static uint8_t buffer_keys[INPUT_BUFSIZE];
+
+/* Makes readers take turns as the ring's single consumer. */
+static struct lock read_lock;
+
+/* Pollers waiting for keys, including blocked readers. */
+static struct waitq pollers;
+
+static size_t pop (uint8_t *, size_t);
+
+/* Initializes the input buffer. */
+void
+input_init (void) {
+	RINGBUF_INIT_ARRAY (&buffer, buffer_keys);
+	lock_init (&read_lock);
+	waitq_init (&pollers);
+}
+
+/* 입력 버퍼에 키를 추가한다.
+인터럽트는 꺼져 있어야 하며, 버퍼는 가득 차 있지 않아야 한다. */
+void
+input_putc (uint8_t key) {
+	ASSERT (intr_get_level () == INTR_OFF);
+	ASSERT (!ringbuf_full (&buffer));
+
+	ringbuf_push (&buffer, &key, 1);
+	serial_notify ();
+	waitq_wake (&pollers);
+}
+
+/* 입력 버퍼에서 키를 하나 가져온다.
+   버퍼가 비어 있으면 키가 입력될 때까지 대기한다. */
+uint8_t
+input_getc (void) {
+	uint8_t key;
+
+	input_read (&key, 1, true);
+	return key;
+}
+
+/* Moves up to SIZE keys from the input buffer into BUF, as the
+   ring's consumer.  Returns the number of keys moved. */
+static size_t
+pop (uint8_t *buf, size_t size) {
+	size_t done;
+
+	lock_acquire (&read_lock);
+	done = ringbuf_pop (&buffer, buf, size);
+	lock_release (&read_lock);
+	return done;
+}
+
+/* Moves up to SIZE keys from the input buffer into BUF: all that are
+   there, after waiting for the first one if BLOCK is true.  Returns
+   the number of keys moved, which is 0 also if the wait was
+   interrupted (poller_interrupt()). */
+size_t
+input_read (uint8_t *buf, size_t size, bool block) {
+	enum intr_level old_level;
+	size_t done;
+
+	if (size == 0)
+		return 0;
+	done = pop (buf, size);
+	if (done == 0 && block) {
+		struct poller p;
+		struct waitq_entry e;
+
+		/* Sleeps without READ_LOCK, which would hold up non-blocking
+		   readers, and pops again after hooking on so that no key
+		   that arrives meanwhile goes unnoticed. */
+		poller_init (&p);
+		poller_add (&p, &pollers, &e);
+		while ((done = pop (buf, size)) == 0 && !poller_interrupted (&p))
+			poller_wait (&p, -1);
+		poller_remove (&e);
+	}
+
+	/* There may be room again for the serial port to receive. */
+	if (done > 0) {
+		old_level = intr_disable ();
+		serial_notify ();
+		intr_set_level (old_level);
+	}
+	return done;
+}
+
+/* Returns true if a key is waiting in the input buffer.  Unless P is
+   null, also hooks it onto the input buffer through E, to be woken
+   when a key arrives. */
+bool
+input_poll (struct poller *p, struct waitq_entry *e) {
+	if (p != NULL)
+		poller_add (p, &pollers, e);
+	return !ringbuf_empty (&buffer);
+}
+
+/* Returns true if the input buffer is full,
+   false otherwise. */
+bool
+input_full (void) {
+	return ringbuf_full (&buffer);
+}
@@ -1,120 +1,120 @@
-#include "filesys/filesys.h"
-#include <debug.h>
-#include <stdio.h>
-#include <string.h>
-#include "filesys/file.h"
-#include "filesys/free-map.h"
-#include "filesys/inode.h"
-#include "filesys/directory.h"
-#include "devices/disk.h"
-
-/* 파일 시스템이 저장된 디스크입니다. */
-struct disk *filesys_disk;
-
-static void do_format (void);
-
-/*
- * 파일 시스템 모듈을 초기화합니다.
- * FORMAT이 true이면, 파일 시스템을 다시 포맷합니다.
- */
-void
-filesys_init (bool format) {
-	filesys_disk = disk_get (0, 1);
-	if (filesys_disk == NULL)
-		PANIC ("hd0:1 (hdb) not present, file system initialization failed");
-
-	inode_init ();
-
-#ifdef EFILESYS
-	fat_init ();
-
-	if (format)
-		do_format ();
-
-	fat_open ();
-#else
-	/* Original FS */
-	free_map_init ();
-
-	if (format)
-		do_format ();
-
-	free_map_open ();
-#endif
-}
-
-/* Shuts down the file system module, writing any unwritten data
- * to disk. */
-void
-filesys_done (void) {
-	/* Original FS */
-#ifdef EFILESYS
-	fat_close ();
-#else
-	free_map_close ();
-#endif
-}
-
-/* NAME이라는 이름의 파일을 주어진 INITIAL_SIZE 크기로 생성한다.
-성공하면 true를, 실패하면 false를 반환한다.
-동일한 이름의 파일이 이미 존재하거나 내부 메모리 할당에 실패한 경우 실패한다. */
-bool
-filesys_create (const char *name, off_t initial_size) {
-	disk_sector_t inode_sector = 0;
-	struct dir *dir = dir_open_root ();
-	bool success = (dir != NULL
-			&& free_map_allocate (1, &inode_sector)
-			&& inode_create (inode_sector, initial_size)
-			&& dir_add (dir, name, inode_sector));
-	if (!success && inode_sector != 0)
-		free_map_release (inode_sector, 1);
-	dir_close (dir);
-
-	return success;
-}
-
-/* 주어진 NAME의 파일을 연다.
-성공하면 새 파일을 반환하고, 실패하면 null 포인터를 반환한다.
-NAME에 해당하는 파일이 존재하지 않거나 내부 메모리 할당에 실패한 경우 실패한다. */
-struct file *
-filesys_open (const char *name) {
-	struct dir *dir = dir_open_root ();
-	struct inode *inode = NULL;
-
-	if (dir != NULL)
-		dir_lookup (dir, name, &inode);
-	dir_close (dir);
-
-	return file_open (inode);
-}
-
-/* NAME이라는 이름의 파일을 삭제한다.
-성공하면 true를, 실패하면 false를 반환한다.
-NAME에 해당하는 파일이 존재하지 않거나 내부 메모리 할당에 실패한 경우 실패한다. */
-bool
-filesys_remove (const char *name) {
-	struct dir *dir = dir_open_root ();
-	bool success = dir != NULL && dir_remove (dir, name);
-	dir_close (dir);
-
-	return success;
-}
-
-/* 파일 시스템을 포맷한다. */
-static void
-do_format (void) {
-	printf ("Formatting file system...");
-
-#ifdef EFILESYS
-	/* Create FAT and save it to the disk. */
-	fat_create ();
-	fat_close ();
-#else
-	free_map_create ();
-	if (!dir_create (ROOT_DIR_SECTOR, 16))
-		PANIC ("root directory creation failed");
-	free_map_close ();
-#endif
-
-	printf ("done.\n");
-}
+#include "filesys/filesys.h"
+#include <debug.h>
+#include <stdio.h>
+#include <string.h>
+#include "filesys/file.h"
+#include "filesys/free-map.h"
+#include "filesys/inode.h"
+#include "filesys/directory.h"
+#include "devices/disk.h"
+
+/* 파일 시스템이 저장된 디스크입니다. */
+struct disk *filesys_disk;
+
+static void do_format (void);
+
+/*
+ * 파일 시스템 모듈을 초기화합니다.
+ * FORMAT이 true이면, 파일 시스템을 다시 포맷합니다.
+ */
+void
+filesys_init (bool format) {
+	filesys_disk = disk_get (0, 1);
+	if (filesys_disk == NULL)
+		PANIC ("hd0:1 (hdb) not present, file system initialization failed");
+
+	inode_init ();
+
+#ifdef EFILESYS
+	fat_init ();
+
+	if (format)
+		do_format ();
+
+	fat_open ();
+#else
+	/* Original FS */
+	free_map_init ();
+
+	if (format)
+		do_format ();
+
+	free_map_open ();
+#endif
+}
+
+/* Shuts down the file system module, writing any unwritten data
+ * to disk. */
+void
+filesys_done (void) {
+	/* Original FS */
+#ifdef EFILESYS
+	fat_close ();
+#else
+	free_map_close ();
+#endif
+}
+
+/* NAME이라는 이름의 파일을 주어진 INITIAL_SIZE 크기로 생성한다.
+성공하면 true를, 실패하면 false를 반환한다.
+동일한 이름의 파일이 이미 존재하거나 내부 메모리 할당에 실패한 경우 실패한다. */
+bool
+filesys_create (const char *name, off_t initial_size) {
+	disk_sector_t inode_sector = 0;
+	struct dir *dir = dir_open_root ();
+	bool success = (dir != NULL
+			&& free_map_allocate (1, &inode_sector)
+			&& inode_create (inode_sector, initial_size)
+			&& dir_add (dir, name, inode_sector));
+	if (!success && inode_sector != 0)
+		free_map_release (inode_sector, 1);
+	dir_close (dir);
+
+	return success;
+}
+
+/* 주어진 NAME의 파일을 연다.
+성공하면 새 파일을 반환하고, 실패하면 null 포인터를 반환한다.
+NAME에 해당하는 파일이 존재하지 않거나 내부 메모리 할당에 실패한 경우 실패한다. */
+struct file *
+filesys_open (const char *name) {
+	struct dir *dir = dir_open_root ();
+	struct inode *inode = NULL;
+
+	if (dir != NULL)
+		dir_lookup (dir, name, &inode);
+	dir_close (dir);
+
+	return file_open (inode);
+}
+
+/* NAME이라는 이름의 파일을 삭제한다.
+성공하면 true를, 실패하면 false를 반환한다.
+NAME에 해당하는 파일이 존재하지 않거나 내부 메모리 할당에 실패한 경우 실패한다. */
+bool
+filesys_remove (const char *name) {
+	struct dir *dir = dir_open_root ();
+	bool success = dir != NULL && dir_remove (dir, name);
+	dir_close (dir);
+
+	return success;
+}
+
+/* 파일 시스템을 포맷한다. */
+static void
+do_format (void) {
+	printf ("Formatting file system...");
+
+#ifdef EFILESYS
+	/* Create FAT and save it to the disk. */
+	fat_create ();
+	fat_close ();
+#else
+	free_map_create ();
+	if (!dir_create (ROOT_DIR_SECTOR, 16))
+		PANIC ("root directory creation failed");
+	free_map_close ();
+#endif
+
+	printf ("done.\n");
+}
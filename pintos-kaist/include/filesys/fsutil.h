@@ -1,10 +1,10 @@
-#ifndef FILESYS_FSUTIL_H
-#define FILESYS_FSUTIL_H
-
-void fsutil_ls (char **argv);
-void fsutil_cat (char **argv);
-void fsutil_rm (char **argv);
-void fsutil_put (char **argv);
-void fsutil_get (char **argv);
-
-#endif /* filesys/fsutil.h */
+#ifndef FILESYS_FSUTIL_H
+#define FILESYS_FSUTIL_H
+
+void fsutil_ls (char **argv);
+void fsutil_cat (char **argv);
+void fsutil_rm (char **argv);
+void fsutil_put (char **argv);
+void fsutil_get (char **argv);
+
+#endif /* filesys/fsutil.h */
@@ -0,0 +1,33 @@
+#ifndef __LIB_KERNEL_KLOG_H
+#define __LIB_KERNEL_KLOG_H
+
+#include <debug.h>
+#include <stddef.h>
+
+/* Kernel log.
+
+   klog() formats a message into a timestamped record and queues it
+   in memory, without taking the console lock or waiting for the
+   serial port, so it is cheap enough for hot paths and safe in
+   interrupt handlers.  A drain thread later prints the records at
+   or above the console level and keeps the most recent ones, which
+   dmesg() reads from user space and a panic dumps. */
+
+/* Record levels, most severe first. */
+enum klog_level {
+	KLOG_ERR,                   /* Something failed. */
+	KLOG_WARN,                  /* Something looks wrong. */
+	KLOG_INFO,                  /* Normal but noteworthy. */
+	KLOG_DEBUG,                 /* Tracing, kept in memory only. */
+};
+
+void klog_init (void);
+void klog_start (void);
+void klog_set_console_level (enum klog_level);
+
+void klog (enum klog_level, const char *format, ...) PRINTF_FORMAT (2, 3);
+
+size_t klog_read (char *buf, size_t size);
+void klog_panic (void);
+
+#endif /* lib/kernel/klog.h */
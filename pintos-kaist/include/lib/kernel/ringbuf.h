@@ -0,0 +1,58 @@
+#ifndef __LIB_KERNEL_RINGBUF_H
+#define __LIB_KERNEL_RINGBUF_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Bounded ring buffer of fixed-size elements.
+
+   The capacity is a power of 2, and the caller provides the
+   storage, so that a ring can live in static memory before the
+   kernel has a heap.  Push and pop move batches of elements with
+   at most two memcpy()s each.
+
+   A ring has a single consumer and either a single producer or,
+   if it was given a per-slot SEQ array, any number of them.
+   Neither side takes a lock or turns off interrupts: the producer
+   and the consumer only ever advance their own counter, and
+   publish it with release stores that the other side reads with
+   acquire loads.  So an interrupt handler can feed a ring that a
+   thread drains, or the other way around.
+
+   With several producers, each claims its slots with a
+   compare-and-swap on the head and then marks each slot filled in
+   SEQ.  The consumer stops at the first slot not yet filled, so a
+   producer interrupted halfway only delays what comes after it.
+   Whoever calls ringbuf_pop() must still be the only consumer at
+   the time, which a caller can ensure by turning interrupts off
+   if an interrupt handler also consumes. */
+
+/* A ring buffer. */
+struct ringbuf {
+	uint8_t *buf;               /* CAP elements of ELEM_SIZE bytes. */
+	uint32_t *seq;              /* Slot fill marks, or null if SPSC. */
+	size_t elem_size;           /* Size of an element, in bytes. */
+	uint32_t cap;               /* Number of elements, a power of 2. */
+	uint32_t head;              /* Elements ever claimed by producers. */
+	uint32_t tail;              /* Elements ever taken by the consumer. */
+};
+
+void ringbuf_init (struct ringbuf *, void *buf, uint32_t *seq,
+		size_t cap, size_t elem_size);
+
+/* Initializes RB over array ARRAY, with one element per array
+   element, for a single producer. */
+#define RINGBUF_INIT_ARRAY(RB, ARRAY)                               \
+	ringbuf_init (RB, ARRAY, NULL,                                  \
+			sizeof (ARRAY) / sizeof *(ARRAY), sizeof *(ARRAY))
+
+size_t ringbuf_push (struct ringbuf *, const void *elems, size_t cnt);
+size_t ringbuf_pop (struct ringbuf *, void *elems, size_t cnt);
+
+size_t ringbuf_count (const struct ringbuf *);
+size_t ringbuf_capacity (const struct ringbuf *);
+bool ringbuf_empty (const struct ringbuf *);
+bool ringbuf_full (const struct ringbuf *);
+
+#endif /* lib/kernel/ringbuf.h */
@@ -0,0 +1,106 @@
+#ifndef __LIB_RING_H
+#define __LIB_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Submission and completion rings shared between a user process and
+ * the kernel.
+ *
+ * ring_setup() maps a ring at a page-aligned user address.  The
+ * process queues requests in the submission queue without entering the
+ * kernel, then hands the whole batch over with one ring_enter().  The
+ * kernel posts one completion per request, and the process reaps as
+ * many completions as are ready at once.
+ *
+ * Each queue is a power-of-2 array indexed by free-running 32-bit head
+ * and tail counters.  The process owns the submission tail and the
+ * completion head; the kernel owns the other two. */
+
+/* One request.  OPCODE is a system call number and ARGS are its
+ * arguments, in order.  Only the file system calls listed in
+ * userprog/ring.c are accepted. */
+struct ring_sqe {
+	uint32_t opcode;            /* SYS_READ, SYS_WRITE, ... */
+	uint32_t flags;             /* RING_F_* flags. */
+	uint64_t args[4];           /* System call arguments. */
+	uint64_t user_data;         /* Copied to the completion. */
+};
+
+/* If this request fails, the requests linked to it are not run and
+ * complete with RING_CANCELED.  A chain ends at the first request
+ * without this flag. */
+#define RING_F_LINK 0x1
+
+/* One completion. */
+struct ring_cqe {
+	uint64_t user_data;         /* From the request. */
+	int64_t res;                /* System call's return value. */
+};
+
+/* Result of a request that was not run because an earlier request in
+ * its chain failed. */
+#define RING_CANCELED (-2)
+
+/* Start of a ring. */
+struct ring {
+	uint32_t sq_head;           /* Next request the kernel takes. */
+	uint32_t sq_tail;           /* Next free request slot. */
+	uint32_t sq_entries;        /* Size of the submission queue. */
+	uint32_t cq_head;           /* Next completion to reap. */
+	uint32_t cq_tail;           /* Next completion the kernel posts. */
+	uint32_t cq_entries;        /* Size of the completion queue. */
+	uint8_t pad[40];
+	struct ring_sqe sqes[];     /* Then the completion queue. */
+};
+
+/* Largest submission queue.  The completion queue is twice as big. */
+#define RING_MAX_ENTRIES 256
+
+/* Bytes taken by a ring whose submission queue has ENTRIES slots. */
+#define RING_SIZE(ENTRIES) \
+	(sizeof (struct ring) + (ENTRIES) * sizeof (struct ring_sqe) \
+	 + 2 * (ENTRIES) * sizeof (struct ring_cqe))
+
+/* Returns R's completion queue. */
+static inline struct ring_cqe *
+ring_cqes (struct ring *r) {
+	return (struct ring_cqe *) (r->sqes + r->sq_entries);
+}
+
+/* Returns a free submission slot of R, or a null pointer if the
+ * submission queue is full.  The request is not visible to the kernel
+ * until ring_sq_commit(). */
+static inline struct ring_sqe *
+ring_get_sqe (struct ring *r) {
+	uint32_t head = __atomic_load_n (&r->sq_head, __ATOMIC_ACQUIRE);
+	if (r->sq_tail - head >= r->sq_entries)
+		return NULL;
+	return &r->sqes[r->sq_tail & (r->sq_entries - 1)];
+}
+
+/* Makes the request last returned by ring_get_sqe() visible. */
+static inline void
+ring_sq_commit (struct ring *r) {
+	__atomic_store_n (&r->sq_tail, r->sq_tail + 1, __ATOMIC_RELEASE);
+}
+
+/* Returns the number of completions ready in R. */
+static inline uint32_t
+ring_cq_ready (struct ring *r) {
+	return __atomic_load_n (&r->cq_tail, __ATOMIC_ACQUIRE) - r->cq_head;
+}
+
+/* Returns the Nth ready completion of R, counting from 0. */
+static inline struct ring_cqe *
+ring_cqe_at (struct ring *r, uint32_t n) {
+	return &ring_cqes (r)[(r->cq_head + n) & (r->cq_entries - 1)];
+}
+
+/* Releases the first N ready completions of R at once. */
+static inline void
+ring_cq_advance (struct ring *r, uint32_t n) {
+	__atomic_store_n (&r->cq_head, r->cq_head + n, __ATOMIC_RELEASE);
+}
+
+#endif /* lib/ring.h */
@@ -1,41 +1,85 @@
-#ifndef __LIB_SYSCALL_NR_H
-#define __LIB_SYSCALL_NR_H
-
-/* System call numbers. */
-enum {
-	/* Projects 2 and later. */
-	SYS_HALT,                   /* Halt the operating system. */
-	SYS_EXIT,                   /* Terminate this process. */
-	SYS_FORK,                   /* Clone current process. */
-	SYS_EXEC,                   /* Switch current process. */
-	SYS_WAIT,                   /* Wait for a child process to die. */
-	SYS_CREATE,                 /* Create a file. */
-	SYS_REMOVE,                 /* Delete a file. */
-	SYS_OPEN,                   /* Open a file. */
-	SYS_FILESIZE,               /* Obtain a file's size. */
-	SYS_READ,                   /* Read from a file. */
-	SYS_WRITE,                  /* Write to a file. */
-	SYS_SEEK,                   /* Change position in a file. */
-	SYS_TELL,                   /* Report current position in a file. */
-	SYS_CLOSE,                  /* Close a file. */
-
-	/* Project 3 and optionally project 4. */
-	SYS_MMAP,                   /* Map a file into memory. */
-	SYS_MUNMAP,                 /* Remove a memory mapping. */
-
-	/* Project 4 only. */
-	SYS_CHDIR,                  /* Change the current directory. */
-	SYS_MKDIR,                  /* Create a directory. */
-	SYS_READDIR,                /* Reads a directory entry. */
-	SYS_ISDIR,                  /* Tests if a fd represents a directory. */
-	SYS_INUMBER,                /* Returns the inode number for a fd. */
-	SYS_SYMLINK,                /* Returns the inode number for a fd. */
-
-	/* Extra for Project 2 */
-	SYS_DUP2,                   /* Duplicate the file descriptor */
-
-	SYS_MOUNT,
-	SYS_UMOUNT,
-};
-
-#endif /* lib/syscall-nr.h */
+#ifndef __LIB_SYSCALL_NR_H
+#define __LIB_SYSCALL_NR_H
+
+/* System call numbers. */
+enum {
+	/* Projects 2 and later. */
+	SYS_HALT,                   /* Halt the operating system. */
+	SYS_EXIT,                   /* Terminate this process. */
+	SYS_FORK,                   /* Clone current process. */
+	SYS_EXEC,                   /* Switch current process. */
+	SYS_WAIT,                   /* Wait for a child process to die. */
+	SYS_CREATE,                 /* Create a file. */
+	SYS_REMOVE,                 /* Delete a file. */
+	SYS_OPEN,                   /* Open a file. */
+	SYS_FILESIZE,               /* Obtain a file's size. */
+	SYS_READ,                   /* Read from a file. */
+	SYS_WRITE,                  /* Write to a file. */
+	SYS_SEEK,                   /* Change position in a file. */
+	SYS_TELL,                   /* Report current position in a file. */
+	SYS_CLOSE,                  /* Close a file. */
+
+	/* Project 3 and optionally project 4. */
+	SYS_MMAP,                   /* Map a file into memory. */
+	SYS_MUNMAP,                 /* Remove a memory mapping. */
+
+	/* Project 4 only. */
+	SYS_CHDIR,                  /* Change the current directory. */
+	SYS_MKDIR,                  /* Create a directory. */
+	SYS_READDIR,                /* Reads a directory entry. */
+	SYS_ISDIR,                  /* Tests if a fd represents a directory. */
+	SYS_INUMBER,                /* Returns the inode number for a fd. */
+	SYS_SYMLINK,                /* Returns the inode number for a fd. */
+
+	/* Extra for Project 2 */
+	SYS_DUP2,                   /* Duplicate the file descriptor */
+
+	SYS_MOUNT,
+	SYS_UMOUNT,
+
+	/* Positioned and vectored I/O. */
+	SYS_PREAD,                  /* Read from a file at an offset. */
+	SYS_PWRITE,                 /* Write to a file at an offset. */
+	SYS_READV,                  /* Read into several buffers. */
+	SYS_WRITEV,                 /* Write from several buffers. */
+
+	/* Batched I/O. */
+	SYS_RING_SETUP,             /* Map a submission/completion ring. */
+	SYS_RING_ENTER,             /* Run queued ring requests. */
+
+	SYS_SYSCALL_STATS,          /* Read system call statistics. */
+	SYS_PIPE,                   /* Create a pipe. */
+
+	/* Shared memory. */
+	SYS_SHM_OPEN,               /* Create a shared memory object. */
+	SYS_SHM_MAP,                /* Map a shared memory object. */
+	SYS_SHM_UNMAP,              /* Unmap shared memory. */
+
+	/* Process creation without copying the parent. */
+	SYS_SPAWN,                  /* Start a process from an executable. */
+	SYS_VFORK,                  /* Fork, borrowing the address space. */
+
+	/* Heap. */
+	SYS_BRK,                    /* Set the break. */
+	SYS_SBRK,                   /* Move the break. */
+
+	/* Threads. */
+	SYS_THREAD_SPAWN,           /* Start a thread in this process. */
+	SYS_THREAD_JOIN,            /* Wait for a thread to exit. */
+	SYS_THREAD_EXIT,            /* End the calling thread. */
+	SYS_GETTID,                 /* Get the calling thread's id. */
+
+	/* Futexes. */
+	SYS_FUTEX,                  /* Wait on or wake a user word. */
+
+	/* Event loops. */
+	SYS_FCNTL,                  /* Get or set descriptor flags. */
+	SYS_POLL,                   /* Wait for descriptors to be ready. */
+
+	/* Kernel log. */
+	SYS_DMESG,                  /* Read recent kernel log records. */
+
+	SYS_CALL_CNT                /* Number of system calls. */
+};
+
+#endif /* lib/syscall-nr.h */
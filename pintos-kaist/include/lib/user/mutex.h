@@ -0,0 +1,34 @@
+#ifndef __LIB_USER_MUTEX_H
+#define __LIB_USER_MUTEX_H
+
+#include <stdbool.h>
+#include <syscall.h>
+
+/* A lock for the threads of a process, or for processes that share
+   memory, built on futex().  Taking a free mutex and releasing one
+   nobody waits for stay in user mode. */
+struct mutex {
+	int state;                  /* 0: free, 1: held, 2: held, waited for. */
+};
+
+#define MUTEX_INITIALIZER { 0 }
+
+void mutex_init (struct mutex *);
+bool mutex_trylock (struct mutex *);
+void mutex_lock (struct mutex *);
+void mutex_unlock (struct mutex *);
+
+/* Like a mutex, except that a thread waiting for it lends its
+   priority to the owner.  It holds the owner's thread id, so callers
+   pass their own, from gettid(). */
+struct pi_mutex {
+	int owner;                  /* As for FUTEX_LOCK_PI. */
+};
+
+#define PI_MUTEX_INITIALIZER { 0 }
+
+void pi_mutex_init (struct pi_mutex *);
+void pi_mutex_lock (struct pi_mutex *, pid_t self);
+void pi_mutex_unlock (struct pi_mutex *, pid_t self);
+
+#endif /* lib/user/mutex.h */
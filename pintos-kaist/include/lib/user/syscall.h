@@ -1,83 +1,208 @@
-#ifndef __LIB_USER_SYSCALL_H
-#define __LIB_USER_SYSCALL_H
-
-#include <stdbool.h>
-#include <debug.h>
-#include <stddef.h>
-
-/* 프로세스 식별자 */
-typedef int pid_t;
-#define PID_ERROR ((pid_t) -1)
-
-/* 메모리 매핑 영역 식별자. */
-typedef int off_t;
-#define MAP_FAILED ((void *) NULL)
-
-/*readdir()에 의해 작성되는 파일 이름의 최대 문자 수. */
-#define READDIR_MAX_LEN 14
-
-/* main() 함수의 일반적인 반환값과 exit() 함수의 인자값. */
-#define EXIT_SUCCESS 0          /* Successful execution. */
-#define EXIT_FAILURE 1          /* Unsuccessful execution. */
-
-/*프로젝트 2 및 이후 단계. */
-void halt (void) NO_RETURN;
-void exit (int status) NO_RETURN;
-pid_t fork (const char *thread_name);
-int exec (const char *file);
-int wait (pid_t);
-bool create (const char *file, unsigned initial_size);
-bool remove (const char *file);
-int open (const char *file);
-int filesize (int fd);
-int read (int fd, void *buffer, unsigned length);
-int write (int fd, const void *buffer, unsigned length);
-void seek (int fd, unsigned position);
-unsigned tell (int fd);
-void close (int fd);
-
-// struct lock filesys_lock;
-
-int dup2(int oldfd, int newfd);
-
-/* Project 3 and optionally project 4. */
-void *mmap (void *addr, size_t length, int writable, int fd, off_t offset);
-void munmap (void *addr);
-
-/* Project 4 only. */
-bool chdir (const char *dir);
-bool mkdir (const char *dir);
-bool readdir (int fd, char name[READDIR_MAX_LEN + 1]);
-bool isdir (int fd);
-int inumber (int fd);
-int symlink (const char* target, const char* linkpath);
-
-static inline void* get_phys_addr (void *user_addr) {
-	void* pa;
-	asm volatile ("movq %0, %%rax" ::"r"(user_addr));
-	asm volatile ("int $0x42");
-	asm volatile ("\t movq %%rax, %0": "=r" (pa));
-	return pa;
-}
-
-static inline long long
-get_fs_disk_read_cnt (void) {
-	long long read_cnt;
-	asm volatile ("movq $0, %rdx");
-	asm volatile ("movq $1, %rcx");
-	asm volatile ("int $0x43");
-	asm volatile ("\t movq %%rax, %0": "=r" (read_cnt));
-	return read_cnt;
-}
-
-static inline long long
-get_fs_disk_write_cnt (void) {
-	long long write_cnt;
-	asm volatile ("movq $0, %rdx");
-	asm volatile ("movq $1, %rcx");
-	asm volatile ("int $0x44");
-	asm volatile ("\t movq %%rax, %0": "=r" (write_cnt));
-	return write_cnt;
-}
-
-#endif /* lib/user/syscall.h */
+#ifndef __LIB_USER_SYSCALL_H
+#define __LIB_USER_SYSCALL_H
+
+#include <stdbool.h>
+#include <debug.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <syscall-nr.h>
+
+/* 프로세스 식별자 */
+typedef int pid_t;
+#define PID_ERROR ((pid_t) -1)
+
+/* 메모리 매핑 영역 식별자. */
+typedef int off_t;
+#define MAP_FAILED ((void *) NULL)
+
+/*readdir()에 의해 작성되는 파일 이름의 최대 문자 수. */
+#define READDIR_MAX_LEN 14
+
+/* One buffer of a readv() or writev() call. */
+struct iovec {
+	void *iov_base;             /* Start of buffer. */
+	size_t iov_len;             /* Size of buffer in bytes. */
+};
+
+/* Most buffers one readv() or writev() call accepts. */
+#define IOV_MAX 16
+
+/* main() 함수의 일반적인 반환값과 exit() 함수의 인자값. */
+#define EXIT_SUCCESS 0          /* Successful execution. */
+#define EXIT_FAILURE 1          /* Unsuccessful execution. */
+
+/*프로젝트 2 및 이후 단계. */
+void halt (void) NO_RETURN;
+void exit (int status) NO_RETURN;
+pid_t fork (const char *thread_name);
+int exec (const char *file);
+int wait (pid_t);
+bool create (const char *file, unsigned initial_size);
+bool remove (const char *file);
+int open (const char *file);
+int filesize (int fd);
+int read (int fd, void *buffer, unsigned length);
+int write (int fd, const void *buffer, unsigned length);
+void seek (int fd, unsigned position);
+unsigned tell (int fd);
+void close (int fd);
+
+// struct lock filesys_lock;
+
+int dup2(int oldfd, int newfd);
+int pipe (int fds[2]);
+
+/* Commands and flags of fcntl(). */
+#define F_GETFL 1               /* Return the descriptor's flags. */
+#define F_SETFL 2               /* Set the descriptor's flags to ARG. */
+#define O_NONBLOCK 0x1          /* Fail with -1 instead of waiting. */
+
+int fcntl (int fd, int cmd, int arg);
+
+/* One descriptor for poll() to watch. */
+struct pollfd {
+	int fd;                     /* Descriptor, ignored if negative. */
+	short events;               /* Events of interest. */
+	short revents;              /* Events that occurred. */
+};
+#define POLLIN 0x1              /* Can read without waiting. */
+#define POLLOUT 0x4             /* Can write without waiting. */
+#define POLLERR 0x8             /* No readers left (output only). */
+#define POLLHUP 0x10            /* No writers left (output only). */
+#define POLLNVAL 0x20           /* FD is not open (output only). */
+
+/* Most descriptors one poll() call accepts. */
+#define POLL_MAX 64
+
+int poll (struct pollfd *fds, int nfds, int timeout_ms);
+
+/* Copies the most recent kernel log records that fit into BUF, one
+   line each, and returns the number of bytes copied. */
+int dmesg (char *buf, unsigned size);
+
+/* One step of setting up the descriptors of a spawn()ed process. */
+struct spawn_action {
+	int op;                     /* SPAWN_CLOSE or SPAWN_DUP2. */
+	int fd;                     /* Descriptor to close or duplicate. */
+	int newfd;                  /* Where SPAWN_DUP2 puts FD. */
+};
+#define SPAWN_CLOSE 1           /* close (fd). */
+#define SPAWN_DUP2 2            /* dup2 (fd, newfd). */
+
+/* Most actions one spawn() call accepts. */
+#define SPAWN_ACTIONS_MAX 16
+
+pid_t spawn (const char *cmd_line, const struct spawn_action *actions,
+		int action_cnt);
+
+/* Like fork(), but the child runs in the parent's memory, on the
+   parent's stack, until it calls exec() or exit(), and only then does
+   the parent return.  The child must do nothing else.  Always inlined,
+   since the parent could not return through a call frame of vfork()'s
+   own after the child's calls had reused its stack. */
+__attribute__((always_inline))
+static inline pid_t
+vfork (void) {
+	int64_t ret;
+	asm volatile ("syscall"
+			: "=a" (ret)
+			: "a" ((uint64_t) SYS_VFORK)
+			: "rcx", "r11", "cc", "memory");
+	return ret;
+}
+
+int shm_open (size_t size);
+void *shm_map (int fd, void *addr, bool writable);
+int shm_unmap (void *addr, size_t size);
+
+int pread (int fd, void *buffer, unsigned length, off_t offset);
+int pwrite (int fd, const void *buffer, unsigned length, off_t offset);
+int readv (int fd, const struct iovec *iov, int iovcnt);
+int writev (int fd, const struct iovec *iov, int iovcnt);
+
+/* The heap starts right past the program's data, empty. */
+int brk (void *addr);
+void *sbrk (intptr_t increment);
+
+/* Threads of one process share its memory and descriptors.  A thread
+   ends when FUNC returns, and exit() from any thread ends them all. */
+pid_t thread_spawn (void (*func) (void *), void *aux);
+int thread_join (pid_t tid);
+pid_t gettid (void);
+
+/* Operations of futex(). */
+#define FUTEX_WAIT 0            /* Sleep while *ADDR == VAL. */
+#define FUTEX_WAKE 1            /* Wake up to VAL sleepers. */
+#define FUTEX_LOCK_PI 2         /* Lock a PI futex someone holds. */
+#define FUTEX_UNLOCK_PI 3       /* Unlock a PI futex others wait for. */
+
+/* A PI futex holds its owner's thread id, or 0 if unlocked, with this
+   bit set while others wait for it. */
+#define FUTEX_WAITERS 0x40000000
+
+int futex (int *addr, int op, int val);
+
+int ring_setup (void *addr, unsigned entries);
+int ring_enter (unsigned to_submit);
+
+/* Time since boot, from clock_gettime(). */
+struct timespec {
+	int64_t tv_sec;             /* Seconds. */
+	long tv_nsec;               /* Nanoseconds, less than 1e9. */
+};
+
+/* Statistics for one system call, from syscall_stats(). */
+#define SYSCALL_HIST_BUCKETS 32
+struct syscall_stat {
+	uint64_t count;             /* Number of calls. */
+	uint64_t cycles;            /* Total TSC cycles of calls that returned. */
+	uint32_t hist[SYSCALL_HIST_BUCKETS];  /* Calls taking [2^i, 2^(i+1)) cycles. */
+};
+int syscall_stats (int nr, bool global, struct syscall_stat *);
+
+/* Read from the kernel's vDSO pages, without a system call. */
+int clock_gettime (struct timespec *);
+int64_t clock_ticks (void);
+pid_t getpid (void);
+
+/* Project 3 and optionally project 4. */
+void *mmap (void *addr, size_t length, int writable, int fd, off_t offset);
+void munmap (void *addr);
+
+/* Project 4 only. */
+bool chdir (const char *dir);
+bool mkdir (const char *dir);
+bool readdir (int fd, char name[READDIR_MAX_LEN + 1]);
+bool isdir (int fd);
+int inumber (int fd);
+int symlink (const char* target, const char* linkpath);
+
+static inline void* get_phys_addr (void *user_addr) {
+	void* pa;
+	asm volatile ("movq %0, %%rax" ::"r"(user_addr));
+	asm volatile ("int $0x42");
+	asm volatile ("\t movq %%rax, %0": "=r" (pa));
+	return pa;
+}
+
+static inline long long
+get_fs_disk_read_cnt (void) {
+	long long read_cnt;
+	asm volatile ("movq $0, %rdx");
+	asm volatile ("movq $1, %rcx");
+	asm volatile ("int $0x43");
+	asm volatile ("\t movq %%rax, %0": "=r" (read_cnt));
+	return read_cnt;
+}
+
+static inline long long
+get_fs_disk_write_cnt (void) {
+	long long write_cnt;
+	asm volatile ("movq $0, %rdx");
+	asm volatile ("movq $1, %rcx");
+	asm volatile ("int $0x44");
+	asm volatile ("\t movq %%rax, %0": "=r" (write_cnt));
+	return write_cnt;
+}
+
+#endif /* lib/user/syscall.h */
@@ -0,0 +1,33 @@
+#ifndef __LIB_VDSO_H
+#define __LIB_VDSO_H
+
+#include <stdint.h>
+
+/* Kernel data mapped read-only into every user process, so that it can
+ * read the clock and its own pid without a system call.
+ *
+ * The first page is the same frame in every process and holds the
+ * time.  The timer interrupt updates it under a sequence lock: SEQ is
+ * odd while an update is in progress, and a reader retries if SEQ was
+ * odd or changed while it read.  The second page belongs to the
+ * process and holds its identity. */
+
+#define VDSO_ADDR      0x7ffe0000   /* User address of the time page. */
+#define VDSO_PROC_ADDR 0x7ffe1000   /* User address of the process page. */
+#define VDSO_PAGES     2
+
+/* Time page. */
+struct vdso_time {
+	uint32_t seq;               /* Sequence count, odd while updating. */
+	uint32_t freq;              /* Timer interrupts per second. */
+	int64_t ticks;              /* Timer ticks since boot. */
+	uint64_t tsc;               /* Time stamp counter at the last tick. */
+	uint64_t tsc_per_tick;      /* Counter cycles per tick, 0 if unknown. */
+};
+
+/* Process page. */
+struct vdso_proc {
+	int32_t pid;                /* Process identifier. */
+};
+
+#endif /* lib/vdso.h */
@@ -1,12 +1,12 @@
-#ifndef THREADS_FLAGS_H
-#define THREADS_FLAGS_H
-
-#define FLAG_MBS   (1<<1)
-#define FLAG_TF    (1<<8)
-#define FLAG_IF    (1<<9)
-#define FLAG_DF    (1<<10)
-#define FLAG_IOPL  (3<<12)
-#define FLAG_AC    (1<<18)
-#define FLAG_NT    (1<<14)
-
-#endif /* threads/flags.h */
+#ifndef THREADS_FLAGS_H
+#define THREADS_FLAGS_H
+
+#define FLAG_MBS   (1<<1)
+#define FLAG_TF    (1<<8)
+#define FLAG_IF    (1<<9)
+#define FLAG_DF    (1<<10)
+#define FLAG_IOPL  (3<<12)
+#define FLAG_AC    (1<<18)
+#define FLAG_NT    (1<<14)
+
+#endif /* threads/flags.h */
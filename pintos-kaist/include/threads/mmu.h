@@ -1,44 +1,78 @@
-#ifndef THREAD_MMU_H
-#define THREAD_MMU_H
-
-#include <stdbool.h>
-#include <stdint.h>
-#include "threads/pte.h"
-
-//사용자 정의 함수 포인터 타입으로, 각 PTE에 대해 수행할 함수의 형태를 정의한다.
-//pte : 현재 페이지 테이블 항목
-//va : 해당 항목에 대응되는 가상 주소
-//aux : 부가적인 데이터(사용자 정의 목적)
-typedef bool pte_for_each_func (uint64_t *pte, void *va, void *aux);
-
-uint64_t *pml4e_walk (uint64_t *pml4, const uint64_t va, int create);
-uint64_t *pml4_create (void);
-//주어진 pml4 루트 페이지 테이블에 대해, 유효한 항목마다 func(pte, va, aux)를 호출한다.
-//만약 func가 false를 반환하면 순회를 멈추고 전체 함수도 false를 반환한다.
-//va는 해당 항목이 가리키는 가상 주소이다.
-bool pml4_for_each (uint64_t *, pte_for_each_func *, void *); 
-void pml4_destroy (uint64_t *pml4);
-//커널이 한 프로세스에서 다른 프로세스로 전환할 때, 
-//프로세서의 페이지 디렉터리 기준 레지스터를 변경하여 사용자 가상 주소 공간도 전환된다.
-void pml4_activate (uint64_t *pml4); 
-void *pml4_get_page (uint64_t *pml4, const void *upage);
-bool pml4_set_page (uint64_t *pml4, void *upage, void *kpage, bool rw);
-void pml4_clear_page (uint64_t *pml4, void *upage);
-bool pml4_is_dirty (uint64_t *pml4, const void *upage);
-void pml4_set_dirty (uint64_t *pml4, const void *upage, bool dirty);
-bool pml4_is_accessed (uint64_t *pml4, const void *upage);
-void pml4_set_accessed (uint64_t *pml4, const void *upage, bool accessed);
-
-#define is_writable(pte) (*(pte) & PTE_W) //해당 페이지 테이블 항목이 가리키는 가상 주소 공간이 쓰기 가능한지 여부를 반환한다.
-#define is_user_pte(pte) (*(pte) & PTE_U) //주어진 페이지 테이블 항목 pte가 사용자 영역(User)에 속한 항목인지 여부를 판별한다.
-#define is_kern_pte(pte) (!is_user_pte (pte)) //pte가 커널(Kernel) 영역에 속한지 여부를 판별한다
-
-#define pte_get_paddr(pte) (pg_round_down(*(pte)))
-
-/* Segment descriptors for x86-64. */
-struct desc_ptr {
-	uint16_t size;
-	uint64_t address;
-} __attribute__((packed));
-
-#endif /* thread/mm.h */
+#ifndef THREAD_MMU_H
+#define THREAD_MMU_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "threads/pte.h"
+
+//사용자 정의 함수 포인터 타입으로, 각 PTE에 대해 수행할 함수의 형태를 정의한다.
+//pte : 현재 페이지 테이블 항목
+//va : 해당 항목에 대응되는 가상 주소
+//aux : 부가적인 데이터(사용자 정의 목적)
+typedef bool pte_for_each_func (uint64_t *pte, void *va, void *aux);
+
+uint64_t *pml4e_walk (uint64_t *pml4, const uint64_t va, int create);
+uint64_t *pml4e_walk_large (uint64_t *pml4, const uint64_t va, uint64_t size,
+		int create);
+uint64_t *pml4_create (void);
+//주어진 pml4 루트 페이지 테이블에 대해, 유효한 항목마다 func(pte, va, aux)를 호출한다.
+//만약 func가 false를 반환하면 순회를 멈추고 전체 함수도 false를 반환한다.
+//va는 해당 항목이 가리키는 가상 주소이다.
+bool pml4_for_each (uint64_t *, pte_for_each_func *, void *); 
+void pml4_destroy (uint64_t *pml4);
+//커널이 한 프로세스에서 다른 프로세스로 전환할 때, 
+//프로세서의 페이지 디렉터리 기준 레지스터를 변경하여 사용자 가상 주소 공간도 전환된다.
+void pml4_activate (uint64_t *pml4); 
+void pcid_init (void);
+void *pml4_get_page (uint64_t *pml4, const void *upage);
+bool pml4_set_page (uint64_t *pml4, void *upage, void *kpage, bool rw);
+bool pml4_set_shared_page (uint64_t *pml4, void *upage, void *kpage);
+void pml4_pin_page (uint64_t *pml4, void *upage);
+void *pml4_share_page (uint64_t *pml4, const void *upage);
+bool pml4_replace_page (uint64_t *pml4, void *upage, void *kpage);
+bool pml4_cow_fault (uint64_t *pml4, const void *va);
+bool pml4_set_shm_page (uint64_t *pml4, void *upage, void *kpage, bool rw);
+bool pml4_clear_shm_page (uint64_t *pml4, void *upage);
+bool pml4_release_page (uint64_t *pml4, void *upage);
+void pml4_clear_page (uint64_t *pml4, void *upage);
+bool pml4_is_dirty (uint64_t *pml4, const void *upage);
+void pml4_set_dirty (uint64_t *pml4, const void *upage, bool dirty);
+bool pml4_is_accessed (uint64_t *pml4, const void *upage);
+void pml4_set_accessed (uint64_t *pml4, const void *upage, bool accessed);
+
+/* Deferred TLB invalidation for bulk page-table updates.
+ * Between tlb_batch_begin() and tlb_batch_flush(), the pml4_* helpers
+ * above queue the pages they change in the current thread's batch
+ * instead of invalidating each one on the spot.  Past TLB_BATCH_MAX
+ * pages, the flush drops every entry of the address space at once.
+ * Frames that unmapping releases are held until the invalidation,
+ * so that no stale entry reaches a frame in its next use. */
+#define TLB_BATCH_MAX 32
+
+struct tlb_batch {
+	uint64_t *pml4;                 /* Address space being updated. */
+	size_t cnt;                     /* Number of pages in VA. */
+	bool flush_all;                 /* Too many pages; flush everything. */
+	uint64_t va[TLB_BATCH_MAX];     /* Pages awaiting invalidation. */
+	size_t frame_cnt;               /* Number of frames in FRAMES. */
+	void *frames[TLB_BATCH_MAX];    /* Frames to free after that. */
+};
+
+void tlb_batch_begin (struct tlb_batch *, uint64_t *pml4);
+void tlb_batch_add (struct tlb_batch *, const void *va);
+void tlb_batch_flush (struct tlb_batch *);
+
+#define is_writable(pte) (*(pte) & PTE_W) //해당 페이지 테이블 항목이 가리키는 가상 주소 공간이 쓰기 가능한지 여부를 반환한다.
+#define is_user_pte(pte) (*(pte) & PTE_U) //주어진 페이지 테이블 항목 pte가 사용자 영역(User)에 속한 항목인지 여부를 판별한다.
+#define is_kern_pte(pte) (!is_user_pte (pte)) //pte가 커널(Kernel) 영역에 속한지 여부를 판별한다
+
+#define pte_get_paddr(pte) (pg_round_down(*(pte)))
+
+/* Segment descriptors for x86-64. */
+struct desc_ptr {
+	uint16_t size;
+	uint64_t address;
+} __attribute__((packed));
+
+#endif /* thread/mm.h */
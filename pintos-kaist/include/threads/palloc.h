@@ -1,23 +1,31 @@
-#ifndef THREADS_PALLOC_H
-#define THREADS_PALLOC_H
-
-#include <stdint.h>
-#include <stddef.h>
-
-/* How to allocate pages. */
-enum palloc_flags {
-	PAL_ASSERT = 001,           /* Panic on failure. */
-	PAL_ZERO = 002,             /* 페이지 내용을 0으로 초기화한다. */
-	PAL_USER = 004              /* 유저 페이지로 할당?. */ 
-};
-
-/* Maximum number of pages to put in user pool. */
-extern size_t user_page_limit;
-
-uint64_t palloc_init (void);
-void *palloc_get_page (enum palloc_flags);
-void *palloc_get_multiple (enum palloc_flags, size_t page_cnt);
-void palloc_free_page (void *);
-void palloc_free_multiple (void *, size_t page_cnt);
-
-#endif /* threads/palloc.h */
+#ifndef THREADS_PALLOC_H
+#define THREADS_PALLOC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/* How to allocate pages. */
+enum palloc_flags {
+	PAL_ASSERT = 001,           /* Panic on failure. */
+	PAL_ZERO = 002,             /* 페이지 내용을 0으로 초기화한다. */
+	PAL_USER = 004              /* 유저 페이지로 할당?. */ 
+};
+
+/* Maximum number of pages to put in user pool. */
+extern size_t user_page_limit;
+
+/* Tries to give pages back when a pool runs dry.  See
+   palloc_set_reclaim(). */
+typedef bool palloc_reclaim_func (void);
+
+uint64_t palloc_init (void);
+void *palloc_get_page (enum palloc_flags);
+void *palloc_get_multiple (enum palloc_flags, size_t page_cnt);
+void palloc_free_page (void *);
+void palloc_free_multiple (void *, size_t page_cnt);
+void palloc_set_reclaim (palloc_reclaim_func *);
+bool palloc_page_ref (void *);
+bool palloc_page_shared (void *);
+
+#endif /* threads/palloc.h */
@@ -1,170 +1,191 @@
-#ifndef THREADS_THREAD_H
-#define THREADS_THREAD_H
-
-#include <debug.h>
-#include <list.h>
-#include <stdint.h>
-#include "threads/interrupt.h"
-#include "threads/synch.h"
-#ifdef VM
-#include "vm/vm.h"
-#endif
-
-
-/* States in a thread's life cycle. */
-enum thread_status {
-	THREAD_RUNNING,     /* Running thread. */
-	THREAD_READY,       /* Not running but ready to run. */
-	THREAD_BLOCKED,     /* Waiting for an event to trigger. */
-	THREAD_DYING        /* About to be destroyed. */
-};
-
-/* Thread identifier type.
-   You can redefine this to whatever type you like. */
-typedef int tid_t;
-#define TID_ERROR ((tid_t) -1)          /* Error value for tid_t. */
-
-/* Thread priorities. */
-#define PRI_MIN 0                       /* Lowest priority. */
-#define PRI_DEFAULT 31                  /* Default priority. */
-#define PRI_MAX 63                      /* Highest priority. */
-
-/* A kernel thread or user process.
- *
- * Each thread structure is stored in its own 4 kB page.  The
- * thread structure itself sits at the very bottom of the page
- * (at offset 0).  The rest of the page is reserved for the
- * thread's kernel stack, which grows downward from the top of
- * the page (at offset 4 kB).  Here's an illustration:
- *
- *      4 kB +---------------------------------+
- *           |          kernel stack           |
- *           |                |                |
- *           |                |                |
- *           |                V                |
- *           |         grows downward          |
- *           |                                 |
- *           |                                 |
- *           |                                 |
- *           |                                 |
- *           |                                 |
- *           |                                 |
- *           |                                 |
- *           |                                 |
- *           +---------------------------------+
- *           |              magic              |
- *           |            intr_frame           |
- *           |                :                |
- *           |                :                |
- *           |               name              |
- *           |              status             |
- *      0 kB +---------------------------------+
- *
- * The upshot of this is twofold:
- *
- *    1. First, `struct thread' must not be allowed to grow too
- *       big.  If it does, then there will not be enough room for
- *       the kernel stack.  Our base `struct thread' is only a
- *       few bytes in size.  It probably should stay well under 1
- *       kB.
- *
- *    2. Second, kernel stacks must not be allowed to grow too
- *       large.  If a stack overflows, it will corrupt the thread
- *       state.  Thus, kernel functions should not allocate large
- *       structures or arrays as non-static local variables.  Use
- *       dynamic allocation with malloc() or palloc_get_page()
- *       instead.
- *
- * The first symptom of either of these problems will probably be
- * an assertion failure in thread_current(), which checks that
- * the `magic' member of the running thread's `struct thread' is
- * set to THREAD_MAGIC.  Stack overflow will normally change this
- * value, triggering the assertion. */
-/* The `elem' member has a dual purpose.  It can be an element in
- * the run queue (thread.c), or it can be an element in a
- * semaphore wait list (synch.c).  It can be used these two ways
- * only because they are mutually exclusive: only a thread in the
- * ready state is on the run queue, whereas only a thread in the
- * blocked state is on a semaphore wait list. */
-struct thread {
-	/* Owned by thread.c. */
-	tid_t tid;                          /* Thread identifier. */
-	enum thread_status status;          /* Thread state. */
-	char name[16];                      /* Name (for debugging purposes). */
-	int priority;                       /* Priority. */
-	int64_t getuptick;
-	/* Shared between thread.c and synch.c. */
-	struct list_elem elem;              /* List element. */
-	/* Donation variables */
-	struct list donations;				/* list of Donations (for multiple Donation).*/
-	struct list_elem d_elem;			/* donation List element. */
-	struct lock *wait_on_lock; 			/* lock that it waits for. */
-	int origin_priority;
-	struct thread *parent;
-
-	struct file *fd_table[64];
-	int fd;
-	struct semaphore wait_sema;
-	struct semaphore child_sema;
-	struct semaphore fork_sema;
-
-	struct list children;
-	struct list_elem ch_elem;
-
-	int wait_check;
-	int exit_status;
-
-#ifdef USERPROG
-	/* Owned by userprog/process.c. */
-	uint64_t *pml4;                     /* Page map level 4 */
-#endif
-#ifdef VM
-	/* Table for whole virtual memory owned by thread. */
-	struct supplemental_page_table spt;
-#endif
-
-	/* Owned by thread.c. */
-	struct intr_frame tf;               /* Information for switching */
-	unsigned magic;                     /* Detects stack overflow. */
-};
-
-/* If false (default), use round-robin scheduler.
-   If true, use multi-level feedback queue scheduler.
-   Controlled by kernel command-line option "-o mlfqs". */
-extern bool thread_mlfqs;
-
-void thread_init (void);
-void thread_start (void);
-int64_t global_tick;
-void thread_tick (void);
-void thread_print_stats (void);
-
-typedef void thread_func (void *aux);
-tid_t thread_create (const char *name, int priority, thread_func *, void *);
-
-void thread_block (void);
-void thread_unblock (struct thread *);
-
-struct thread *thread_current (void);
-tid_t thread_tid (void);
-const char *thread_name (void);
-
-void thread_exit (void) NO_RETURN;
-void thread_yield (void);
-// 정의한 함수 선언 - ch
-bool getuptick_less(const struct list_elem *a_, const struct list_elem *b_, void *aux UNUSED);
-bool priority_more(const struct list_elem *a_, const struct list_elem *b_, void *aux UNUSED);
-void thread_sleep(int64_t getuptick);
-void wakeup(void);
-// end
-int thread_get_priority(void);
-void thread_set_priority (int);
-
-int thread_get_nice (void);
-void thread_set_nice (int);
-int thread_get_recent_cpu (void);
-int thread_get_load_avg (void);
-
-void do_iret (struct intr_frame *tf);
-
+#ifndef THREADS_THREAD_H
+#define THREADS_THREAD_H
+
+#include <debug.h>
+#include <hash.h>
+#include <list.h>
+#include <stdint.h>
+#include "threads/interrupt.h"
+#include "threads/synch.h"
+#ifdef VM
+#include "vm/vm.h"
+#endif
+
+
+/* States in a thread's life cycle. */
+enum thread_status {
+	THREAD_RUNNING,     /* Running thread. */
+	THREAD_READY,       /* Not running but ready to run. */
+	THREAD_BLOCKED,     /* Waiting for an event to trigger. */
+	THREAD_DYING        /* About to be destroyed. */
+};
+
+/* Thread identifier type.
+   You can redefine this to whatever type you like. */
+typedef int tid_t;
+#define TID_ERROR ((tid_t) -1)          /* Error value for tid_t. */
+
+/* Thread priorities. */
+#define PRI_MIN 0                       /* Lowest priority. */
+#define PRI_DEFAULT 31                  /* Default priority. */
+#define PRI_MAX 63                      /* Highest priority. */
+
+/* A kernel thread or user process.
+ *
+ * Each thread structure is stored in its own 4 kB page.  The
+ * thread structure itself sits at the very bottom of the page
+ * (at offset 0).  The rest of the page is reserved for the
+ * thread's kernel stack, which grows downward from the top of
+ * the page (at offset 4 kB).  Here's an illustration:
+ *
+ *      4 kB +---------------------------------+
+ *           |          kernel stack           |
+ *           |                |                |
+ *           |                |                |
+ *           |                V                |
+ *           |         grows downward          |
+ *           |                                 |
+ *           |                                 |
+ *           |                                 |
+ *           |                                 |
+ *           |                                 |
+ *           |                                 |
+ *           |                                 |
+ *           |                                 |
+ *           +---------------------------------+
+ *           |              magic              |
+ *           |            intr_frame           |
+ *           |                :                |
+ *           |                :                |
+ *           |               name              |
+ *           |              status             |
+ *      0 kB +---------------------------------+
+ *
+ * The upshot of this is twofold:
+ *
+ *    1. First, `struct thread' must not be allowed to grow too
+ *       big.  If it does, then there will not be enough room for
+ *       the kernel stack.  Our base `struct thread' is only a
+ *       few bytes in size.  It probably should stay well under 1
+ *       kB.
+ *
+ *    2. Second, kernel stacks must not be allowed to grow too
+ *       large.  If a stack overflows, it will corrupt the thread
+ *       state.  Thus, kernel functions should not allocate large
+ *       structures or arrays as non-static local variables.  Use
+ *       dynamic allocation with malloc() or palloc_get_page()
+ *       instead.
+ *
+ * The first symptom of either of these problems will probably be
+ * an assertion failure in thread_current(), which checks that
+ * the `magic' member of the running thread's `struct thread' is
+ * set to THREAD_MAGIC.  Stack overflow will normally change this
+ * value, triggering the assertion. */
+/* The `elem' member has a dual purpose.  It can be an element in
+ * the run queue (thread.c), or it can be an element in a
+ * semaphore wait list (synch.c).  It can be used these two ways
+ * only because they are mutually exclusive: only a thread in the
+ * ready state is on the run queue, whereas only a thread in the
+ * blocked state is on a semaphore wait list. */
+struct thread {
+	/* Owned by thread.c. */
+	tid_t tid;                          /* Thread identifier. */
+	enum thread_status status;          /* Thread state. */
+	char name[16];                      /* Name (for debugging purposes). */
+	int priority;                       /* Priority. */
+	int64_t getuptick;
+	/* Shared between thread.c and synch.c. */
+	struct list_elem elem;              /* List element. */
+	/* Donation variables */
+	struct list donations;				/* list of Donations (for multiple Donation).*/
+	struct list_elem d_elem;			/* donation List element. */
+	struct lock *wait_on_lock; 			/* lock that it waits for. */
+	int origin_priority;
+	struct thread *parent;
+	struct hash_elem table_elem;        /* Element in the thread table. */
+	struct poller *poller;              /* Asleep in poller_wait() on this,
+	                                       or null (threads/waitq.c). */
+	bool interrupted;                   /* Set by poller_interrupt(). */
+	struct tlb_batch *tlb_batch;        /* Open TLB batch (threads/mmu.c). */
+
+	struct fd_table *fd_table;           /* Open files (userprog/fd.c). */
+	struct fdesc *fd_held;               /* Description a system call is
+	                                        using, or null. */
+	struct io_ring *ring;                /* Shared ring (userprog/ring.c). */
+	struct syscall_stat *sc_stats;       /* Per-process system call
+	                                        statistics, kept on the
+	                                        leader, or null. */
+
+	struct hash children;               /* Children's exit records by tid.
+	                                       Set up on first use. */
+	struct child_rec *exit_rec;         /* Own exit record, if a process. */
+
+	int exit_status;
+	struct file *running_file;
+
+#ifdef USERPROG
+	/* Owned by userprog/process.c. */
+	uint64_t *pml4;                     /* Page map level 4 */
+	struct semaphore *vfork_done;       /* Upped when done borrowing the
+	                                       parent's pml4, after vfork(). */
+	uint8_t *heap_base;                 /* Start of the heap. */
+	uint8_t *heap_brk;                  /* Current break (userprog/heap.c). */
+	struct uthread_group *group;        /* Threads sharing the process
+	                                       (userprog/uthread.c), or null. */
+	struct uthread_rec *join_rec;       /* Own record in GROUP, unless
+	                                       the process's leader. */
+	struct list_elem group_elem;        /* Element in GROUP's members,
+	                                       unless the leader. */
+#endif
+#ifdef VM
+	/* Table for whole virtual memory owned by thread. */
+	struct supplemental_page_table spt;
+#endif
+
+	/* Owned by thread.c. */
+	struct intr_frame tf;               /* Information for switching */
+	unsigned magic;                     /* Detects stack overflow. */
+};
+
+/* If false (default), use round-robin scheduler.
+   If true, use multi-level feedback queue scheduler.
+   Controlled by kernel command-line option "-o mlfqs". */
+extern bool thread_mlfqs;
+
+void thread_init (void);
+void thread_start (void);
+int64_t global_tick;
+void thread_tick (void);
+void thread_print_stats (void);
+
+typedef void thread_func (void *aux);
+tid_t thread_create (const char *name, int priority, thread_func *, void *);
+
+void thread_block (void);
+void thread_unblock (struct thread *);
+
+struct thread *thread_current (void);
+struct thread *thread_find (tid_t);
+tid_t thread_tid (void);
+const char *thread_name (void);
+
+void thread_exit (void) NO_RETURN;
+void thread_yield (void);
+// 정의한 함수 선언 - ch
+bool getuptick_less(const struct list_elem *a_, const struct list_elem *b_, void *aux UNUSED);
+bool priority_more(const struct list_elem *a_, const struct list_elem *b_, void *aux UNUSED);
+void thread_sleep(int64_t getuptick);
+void wakeup(void);
+void thread_wake_early (struct thread *);
+// end
+int thread_get_priority(void);
+void thread_set_priority (int);
+
+int thread_get_nice (void);
+void thread_set_nice (int);
+int thread_get_recent_cpu (void);
+int thread_get_load_avg (void);
+
+void do_iret (struct intr_frame *tf);
+
 #endif /* threads/thread.h */
\ No newline at end of file
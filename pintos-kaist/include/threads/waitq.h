@@ -0,0 +1,54 @@
+#ifndef THREADS_WAITQ_H
+#define THREADS_WAITQ_H
+
+#include <list.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+struct thread;
+
+/* Waiting for any of several events at once, as poll() does.
+
+   Whatever can become ready, such as the input buffer or a pipe,
+   keeps a waitq and calls waitq_wake() whenever it might have.  A
+   thread that waits makes itself a poller, hooks a waitq_entry onto
+   the waitq of each thing it waits for, checks them, and sleeps in
+   poller_wait() if none was ready.  A wake-up between the check and
+   the sleep is not lost: poller_wait() returns at once.
+
+   poller_interrupt() makes a thread's poller_wait()s return at once,
+   now and from then on, so that a thread that has to exit does not
+   stay asleep.  Callers find out with poller_interrupted().
+
+   waitq_wake() may be called from an interrupt handler. */
+
+/* A thread waiting for waitqs. */
+struct poller {
+	struct thread *thread;      /* The waiting thread. */
+	bool woken;                 /* Woken since the last poller_wait()? */
+	bool sleeping;              /* Asleep in poller_wait()? */
+	bool timed;                 /* Asleep on the timer's sleep list? */
+};
+
+/* A poller's hook on one waitq. */
+struct waitq_entry {
+	struct list_elem elem;      /* Element in the waitq's entries. */
+	struct poller *poller;      /* Owner, or null if not hooked. */
+};
+
+/* Pollers to wake up. */
+struct waitq {
+	struct list entries;        /* Hooked waitq_entries. */
+};
+
+void waitq_init (struct waitq *);
+void waitq_wake (struct waitq *);
+
+void poller_init (struct poller *);
+void poller_add (struct poller *, struct waitq *, struct waitq_entry *);
+void poller_remove (struct waitq_entry *);
+bool poller_wait (struct poller *, int64_t deadline);
+void poller_interrupt (struct thread *);
+bool poller_interrupted (const struct poller *);
+
+#endif /* threads/waitq.h */
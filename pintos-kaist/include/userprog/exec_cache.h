@@ -0,0 +1,50 @@
+#ifndef USERPROG_EXEC_CACHE_H
+#define USERPROG_EXEC_CACHE_H
+
+#include <list.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "filesys/off_t.h"
+
+struct inode;
+
+/* One loadable segment of an executable, in load_segment() terms. */
+struct exec_segment {
+	off_t ofs;                  /* Page-aligned offset in the file. */
+	uint8_t *upage;             /* Page-aligned user address. */
+	uint32_t read_bytes;        /* Bytes to read from the file. */
+	uint32_t zero_bytes;        /* Bytes to zero after those. */
+	bool writable;              /* Mapped writable? */
+	void **pages;               /* Resident pages of a read-only segment,
+	                               null where not loaded yet, or null if
+	                               the segment keeps none. */
+};
+
+/* What load() learns from an executable's ELF headers. */
+struct exec_image {
+	struct list_elem elem;      /* Element in the cache's LRU list. */
+	struct inode *inode;        /* Executable, held open by the image. */
+	unsigned gen;               /* INODE's write generation when read. */
+	int users;                  /* References.  Cache lock. */
+	bool cached;                /* In the cache?  Cache lock. */
+	uint64_t entry;             /* Entry point. */
+	int seg_cnt;                /* Number of segments. */
+	int seg_max;                /* Room in SEGS. */
+	struct exec_segment *segs;  /* Loadable segments, in file order. */
+};
+
+void exec_cache_init (void);
+struct exec_image *exec_image_create (struct inode *, uint64_t entry,
+		int seg_max);
+bool exec_image_add (struct exec_image *, off_t ofs, void *upage,
+		uint32_t read_bytes, uint32_t zero_bytes, bool writable);
+struct exec_image *exec_cache_get (struct inode *);
+void exec_cache_insert (struct exec_image *);
+void exec_cache_put (struct exec_image *);
+void *exec_image_page (struct exec_image *, int seg, size_t idx);
+void exec_image_keep_page (struct exec_image *, int seg, size_t idx,
+		void *kpage);
+bool exec_cache_reclaim (void);
+
+#endif /* userprog/exec_cache.h */
@@ -0,0 +1,65 @@
+#ifndef USERPROG_FD_H
+#define USERPROG_FD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "threads/synch.h"
+
+struct file;
+struct pipe;
+struct shm;
+struct stdout_buf;
+
+/* What an open file description refers to. */
+enum fdesc_kind {
+	FD_STDIN,                   /* Keyboard input. */
+	FD_STDOUT,                  /* Console output. */
+	FD_FILE,                    /* File system file. */
+	FD_PIPE_READ,               /* Read end of a pipe. */
+	FD_PIPE_WRITE,              /* Write end of a pipe. */
+	FD_SHM,                     /* Shared memory object. */
+};
+
+/* An open file description.  dup2() makes several fds of one process
+ * share a description, and with it the file position. */
+struct fdesc {
+	int refcnt;                 /* Number of fds referring to this, plus
+	                               system calls using it. */
+	enum fdesc_kind kind;       /* What this refers to. */
+	int flags;                  /* O_NONBLOCK, from fcntl(). */
+	struct file *file;          /* Open file, for FD_FILE. */
+	struct pipe *pipe;          /* Pipe, for FD_PIPE_*. */
+	struct shm *shm;            /* Shared memory, for FD_SHM. */
+	struct stdout_buf *out;     /* Output buffer for FD_STDOUT, or null
+	                               to write straight to the console. */
+	struct fdesc *fork_copy;    /* Child's copy, during fd_table_fork(). */
+};
+
+/* A process's file descriptor table.  It lives outside the thread
+ * page and grows on demand, a bitmap word at a time, up to FD_MAX
+ * descriptors. */
+struct fd_table {
+	struct lock lock;           /* Protects the members below and the
+	                               descriptions' REFCNTs. */
+	struct fdesc **slots;       /* Descriptions, indexed by fd. */
+	uint64_t *used;             /* Bitmap of open fds. */
+	int cap;                    /* Number of slots, a multiple of 64. */
+};
+
+#define FD_MAX 4096             /* Most descriptors per process. */
+
+struct fd_table *fd_table_create (void);
+struct fd_table *fd_table_fork (struct fd_table *);
+void fd_table_destroy (struct fd_table *);
+
+int fd_alloc (struct fd_table *, enum fdesc_kind, struct file *);
+int fd_alloc_pipe (struct fd_table *, enum fdesc_kind, struct pipe *);
+int fd_alloc_shm (struct fd_table *, struct shm *);
+struct fdesc *fd_get (struct fd_table *, int fd);
+void fd_put (struct fd_table *, struct fdesc *);
+bool fd_close (struct fd_table *, int fd);
+int fd_dup2 (struct fd_table *, int oldfd, int newfd);
+void fd_flush (struct fd_table *);
+void fd_close_pipes (struct fd_table *);
+
+#endif /* userprog/fd.h */
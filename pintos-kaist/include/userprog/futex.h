@@ -0,0 +1,16 @@
+#ifndef USERPROG_FUTEX_H
+#define USERPROG_FUTEX_H
+
+#include "threads/thread.h"
+
+struct uthread_group;
+
+void futex_init (void);
+int futex_wait (int *uaddr, int val);
+int futex_wake (int *uaddr, int cnt);
+int futex_lock_pi (int *uaddr);
+int futex_unlock_pi (int *uaddr);
+void futex_exit (struct thread *);
+void futex_interrupt (const struct uthread_group *);
+
+#endif /* userprog/futex.h */
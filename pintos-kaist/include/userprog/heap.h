@@ -0,0 +1,15 @@
+#ifndef USERPROG_HEAP_H
+#define USERPROG_HEAP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct thread;
+
+void heap_init (struct thread *, void *end);
+void heap_copy (struct thread *child, struct thread *parent);
+void *heap_sbrk (intptr_t increment);
+bool heap_brk (void *addr);
+bool heap_fault (const void *va);
+
+#endif /* userprog/heap.h */
@@ -0,0 +1,19 @@
+#ifndef USERPROG_PIPE_H
+#define USERPROG_PIPE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+struct pipe;
+struct poller;
+struct waitq_entry;
+
+struct pipe *pipe_create (void);
+void pipe_open (struct pipe *, bool write_end);
+void pipe_close (struct pipe *, bool write_end);
+int pipe_read (struct pipe *, void *ubuf, size_t size, bool nonblock);
+int pipe_write (struct pipe *, const void *ubuf, size_t size, bool nonblock);
+int pipe_poll (struct pipe *, bool write_end, struct poller *,
+		struct waitq_entry *);
+
+#endif /* userprog/pipe.h */
@@ -1,13 +1,19 @@
-#ifndef USERPROG_PROCESS_H
-#define USERPROG_PROCESS_H
-
-#include "threads/thread.h"
-
-tid_t process_create_initd (const char *file_name);
-tid_t process_fork (const char *name, struct intr_frame *if_);
-int process_exec (void *f_name);
-int process_wait (tid_t);
-void process_exit (void);
-void process_activate (struct thread *next);
-
-#endif /* userprog/process.h */
+#ifndef USERPROG_PROCESS_H
+#define USERPROG_PROCESS_H
+
+#include "threads/thread.h"
+
+tid_t process_create_initd (const char *file_name);
+struct spawn_action;
+
+tid_t process_fork (const char *name, struct intr_frame *if_);
+tid_t process_spawn (const char *cmd_line, const struct spawn_action *,
+		int action_cnt);
+tid_t process_vfork (const char *name, struct intr_frame *if_);
+int process_exec (void *f_name);
+int process_wait (tid_t);
+void process_exit (void);
+void process_activate (struct thread *next);
+void reaper_init (void);
+
+#endif /* userprog/process.h */
@@ -0,0 +1,10 @@
+#ifndef USERPROG_RING_H
+#define USERPROG_RING_H
+
+struct thread;
+
+int ring_setup (void *uaddr, unsigned entries);
+int ring_enter (unsigned to_submit);
+void ring_destroy (struct thread *);
+
+#endif /* userprog/ring.h */
@@ -0,0 +1,18 @@
+#ifndef USERPROG_SHM_H
+#define USERPROG_SHM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+struct shm;
+
+/* Largest shared memory object, in pages. */
+#define SHM_MAX_PAGES 1024
+
+struct shm *shm_create (size_t size);
+void shm_ref (struct shm *);
+void shm_close (struct shm *);
+void *shm_attach (struct shm *, void *addr, bool writable);
+bool shm_detach (void *addr, size_t size);
+
+#endif /* userprog/shm.h */
@@ -0,0 +1,13 @@
+#ifndef USERPROG_STDOUT_H
+#define USERPROG_STDOUT_H
+
+#include <stddef.h>
+
+struct stdout_buf;
+
+struct stdout_buf *stdout_create (void);
+void stdout_write (struct stdout_buf *, const char *, size_t);
+void stdout_flush (struct stdout_buf *);
+void stdout_destroy (struct stdout_buf *);
+
+#endif /* userprog/stdout.h */
@@ -1,13 +1,17 @@
-#include "threads/synch.h"
-#include "lib/user/syscall.h"
-
-
-#ifndef USERPROG_SYSCALL_H
-#define USERPROG_SYSCALL_H
-
-void syscall_init (void);
-
-struct lock filesys_lock;
-struct lock fork_lock;
-
-#endif /* userprog/syscall.h */
+#include "threads/synch.h"
+#include "lib/user/syscall.h"
+
+
+#ifndef USERPROG_SYSCALL_H
+#define USERPROG_SYSCALL_H
+
+void syscall_init (void);
+struct intr_frame;
+void syscall_handler (struct intr_frame *);
+void syscall_exit (int status);
+void syscall_print_stats (void);
+
+struct lock filesys_lock;
+struct lock fork_lock;
+
+#endif /* userprog/syscall.h */
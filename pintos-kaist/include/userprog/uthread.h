@@ -0,0 +1,35 @@
+#ifndef USERPROG_UTHREAD_H
+#define USERPROG_UTHREAD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "threads/thread.h"
+#include "threads/vaddr.h"
+
+/* Most threads a process runs besides its first. */
+#define UTHREAD_MAX 32
+
+/* Size of the user stack of each of those threads, guard page
+ * included. */
+#define UTHREAD_STACK_SIZE (64 * 1024)
+
+/* Their stacks lie below the first thread's stack, leaving it 1 MB,
+ * and the heap stays below them (userprog/heap.c). */
+#define UTHREAD_STACKS_TOP ((uint8_t *) USER_STACK - (1 << 20))
+#define UTHREAD_STACKS_BOTTOM \
+	(UTHREAD_STACKS_TOP - UTHREAD_MAX * UTHREAD_STACK_SIZE)
+
+tid_t uthread_spawn (void *entry, void *func, void *aux);
+int uthread_join (tid_t);
+void uthread_end (int status) NO_RETURN;
+bool uthread_kill (struct thread *);
+bool uthread_killed (const struct thread *);
+void uthread_check_killed (void);
+bool uthread_leave (struct thread *);
+bool uthread_single (struct thread *);
+struct thread *uthread_leader (struct thread *);
+void uthread_mm_acquire (struct thread *);
+void uthread_mm_release (struct thread *);
+bool uthread_stack_fault (const void *va);
+
+#endif /* userprog/uthread.h */
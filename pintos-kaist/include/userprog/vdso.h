@@ -0,0 +1,14 @@
+#ifndef USERPROG_VDSO_H
+#define USERPROG_VDSO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct thread;
+
+void vdso_init (void);
+void vdso_tick (int64_t ticks);
+bool vdso_map (struct thread *);
+bool vdso_contains (const void *uaddr);
+
+#endif /* userprog/vdso.h */
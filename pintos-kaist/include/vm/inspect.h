@@ -1,4 +1,4 @@
-#ifndef _VM_INSPECT_H_
-#define _VM_INSPECT_H_
-void register_inspect_intr (void);
-#endif
+#ifndef _VM_INSPECT_H_
+#define _VM_INSPECT_H_
+void register_inspect_intr (void);
+#endif
@@ -0,0 +1,208 @@
+#include <klog.h>
+#include <ringbuf.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "devices/timer.h"
+#include "threads/synch.h"
+#include "threads/thread.h"
+#include "threads/waitq.h"
+
+/* Records go from klog() into RING, a multi-producer ring that
+   takes them from any thread or interrupt handler.  The drain
+   thread moves them into HISTORY, printing those at or above the
+   console level on the way.  Whoever drains holds DRAIN_LOCK, which
+   keeps it the ring's only consumer, except for a panic, which
+   drains without it since nothing else runs anymore.
+
+   The kernel runs on a single CPU, so there is a single ring where
+   an SMP kernel would keep one per CPU. */
+
+#define KLOG_RING_SIZE 256          /* Records queued, a power of 2. */
+#define KLOG_HISTORY 256            /* Records kept for dmesg(). */
+#define KLOG_TEXT_MAX 116           /* Message bytes per record, plus
+                                       null terminator. */
+#define KLOG_LINE_MAX 160           /* Longest formatted record. */
+#define KLOG_PANIC_DUMP 32          /* Records a panic prints. */
+
+/* One log record. */
+struct klog_rec {
+	int64_t ticks;                  /* timer_ticks() when logged. */
+	int level;                      /* An enum klog_level. */
+	char text[KLOG_TEXT_MAX];       /* Message, without new-line. */
+};
+
+static struct ringbuf ring;
+static struct klog_rec ring_recs[KLOG_RING_SIZE];
+static uint32_t ring_seq[KLOG_RING_SIZE];
+static unsigned dropped;            /* Records lost to a full ring. */
+
+static struct lock drain_lock;
+static struct klog_rec history[KLOG_HISTORY];
+static uint64_t history_cnt;        /* Records ever moved to HISTORY. */
+
+/* Least severe level printed on the console. */
+static enum klog_level console_level = KLOG_INFO;
+
+/* Waking the drain thread.  DRAIN_IDLE is true while the drain
+   thread is about to sleep on DRAIN_WAITQ, and the first klog()
+   to clear it wakes the thread up. */
+static struct waitq drain_waitq;
+static bool drain_idle;
+
+static thread_func drain_thread;
+static void drain (bool print);
+static size_t format_rec (const struct klog_rec *, char *, size_t);
+
+/* Initializes the kernel log.  Records logged from now on are kept
+   until klog_start() starts printing them. */
+void
+klog_init (void) {
+	ringbuf_init (&ring, ring_recs, ring_seq, KLOG_RING_SIZE,
+			sizeof *ring_recs);
+	lock_init (&drain_lock);
+	waitq_init (&drain_waitq);
+}
+
+/* Starts the thread that drains the log.  Must be called after
+   thread_start(). */
+void
+klog_start (void) {
+	if (thread_create ("klog", PRI_DEFAULT, drain_thread, NULL) == TID_ERROR)
+		PANIC ("cannot start klog");
+}
+
+/* Prints records of LEVEL or more severe on the console from now
+   on. */
+void
+klog_set_console_level (enum klog_level level) {
+	console_level = level;
+}
+
+/* Logs a message at LEVEL, formatted as printf() would.  Messages
+   longer than a record are cut short.  If the log is full, the
+   record is dropped and counted. */
+void
+klog (enum klog_level level, const char *format, ...) {
+	struct klog_rec rec;
+	va_list args;
+	size_t len;
+
+	rec.ticks = timer_ticks ();
+	rec.level = level;
+	va_start (args, format);
+	vsnprintf (rec.text, sizeof rec.text, format, args);
+	va_end (args);
+	len = strlen (rec.text);
+	if (len > 0 && rec.text[len - 1] == '\n')
+		rec.text[len - 1] = '\0';
+
+	if (ringbuf_push (&ring, &rec, 1) == 0)
+		__atomic_fetch_add (&dropped, 1, __ATOMIC_RELAXED);
+	else if (__atomic_exchange_n (&drain_idle, false, __ATOMIC_ACQ_REL))
+		waitq_wake (&drain_waitq);
+}
+
+/* Copies the most recent records that fit in SIZE bytes into BUF,
+   oldest first, one line each, after draining the ring.  Returns
+   the number of bytes copied.  BUF is not null-terminated. */
+size_t
+klog_read (char *buf, size_t size) {
+	char line[KLOG_LINE_MAX];
+	uint64_t first, oldest, i;
+	size_t len = 0;
+
+	lock_acquire (&drain_lock);
+	drain (true);
+
+	oldest = history_cnt > KLOG_HISTORY ? history_cnt - KLOG_HISTORY : 0;
+	for (first = history_cnt; first > oldest; first--) {
+		size_t n = format_rec (&history[(first - 1) % KLOG_HISTORY],
+				line, sizeof line);
+		if (len + n > size)
+			break;
+		len += n;
+	}
+
+	len = 0;
+	for (i = first; i < history_cnt; i++) {
+		size_t n = format_rec (&history[i % KLOG_HISTORY], line, sizeof line);
+		memcpy (buf + len, line, n);
+		len += n;
+	}
+	lock_release (&drain_lock);
+	return len;
+}
+
+/* Prints the last KLOG_PANIC_DUMP records, of every level, for a
+   kernel panic.  Takes no locks. */
+void
+klog_panic (void) {
+	char line[KLOG_LINE_MAX];
+	uint64_t i;
+
+	drain (false);
+	if (history_cnt == 0)
+		return;
+	printf ("Kernel log:\n");
+	i = history_cnt > KLOG_PANIC_DUMP ? history_cnt - KLOG_PANIC_DUMP : 0;
+	for (; i < history_cnt; i++)
+		putbuf (line, format_rec (&history[i % KLOG_HISTORY], line,
+					sizeof line));
+}
+
+/* Drain thread. */
+static void
+drain_thread (void *aux UNUSED) {
+	struct poller p;
+	struct waitq_entry e;
+
+	poller_init (&p);
+	poller_add (&p, &drain_waitq, &e);
+	for (;;) {
+		lock_acquire (&drain_lock);
+		drain (true);
+		lock_release (&drain_lock);
+
+		/* Sleep unless records came in meanwhile.  A klog() after the
+		   check finds DRAIN_IDLE set and wakes us. */
+		__atomic_store_n (&drain_idle, true, __ATOMIC_SEQ_CST);
+		if (ringbuf_empty (&ring))
+			poller_wait (&p, -1);
+		__atomic_store_n (&drain_idle, false, __ATOMIC_RELAXED);
+	}
+}
+
+/* Moves every queued record into HISTORY, printing those at or
+   above the console level if PRINT is true.  The caller must be the
+   ring's only consumer. */
+static void
+drain (bool print) {
+	struct klog_rec recs[4];
+	char line[KLOG_LINE_MAX];
+	unsigned lost;
+	size_t n, i;
+
+	while ((n = ringbuf_pop (&ring, recs, 4)) > 0)
+		for (i = 0; i < n; i++) {
+			history[history_cnt++ % KLOG_HISTORY] = recs[i];
+			if (print && recs[i].level <= (int) console_level)
+				putbuf (line, format_rec (&recs[i], line, sizeof line));
+		}
+
+	lost = __atomic_exchange_n (&dropped, 0, __ATOMIC_RELAXED);
+	if (print && lost > 0)
+		printf ("klog: %u records dropped\n", lost);
+}
+
+/* Formats REC into BUF, which has room for SIZE bytes, as a line
+   of text.  Returns the length of the line, not counting the null
+   terminator. */
+static size_t
+format_rec (const struct klog_rec *rec, char *buf, size_t size) {
+	static const char levels[] = "EWID";
+	int n = snprintf (buf, size, "[%8lld] %c: %s\n", rec->ticks,
+			levels[rec->level], rec->text);
+	return (size_t) n < size ? (size_t) n : size - 1;
+}
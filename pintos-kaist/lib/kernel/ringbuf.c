@@ -0,0 +1,159 @@
+#include "ringbuf.h"
+#include <debug.h>
+#include <string.h>
+
+static size_t push_spsc (struct ringbuf *, const void *, size_t);
+static size_t push_mpsc (struct ringbuf *, const void *, size_t);
+static void copy_in (struct ringbuf *, uint32_t pos, const void *, size_t);
+static void copy_out (const struct ringbuf *, uint32_t pos, void *, size_t);
+
+/* Initializes RB as an empty ring of CAP elements of ELEM_SIZE
+   bytes each, stored in BUF.  CAP must be a power of 2.  If SEQ is
+   non-null, it must have room for CAP counters, and RB then allows
+   several producers. */
+void
+ringbuf_init (struct ringbuf *rb, void *buf, uint32_t *seq,
+		size_t cap, size_t elem_size) {
+	ASSERT (rb != NULL && buf != NULL);
+	ASSERT (cap > 0 && cap <= UINT32_MAX / 2 && (cap & (cap - 1)) == 0);
+	ASSERT (elem_size > 0);
+
+	rb->buf = buf;
+	rb->seq = seq;
+	rb->elem_size = elem_size;
+	rb->cap = cap;
+	rb->head = rb->tail = 0;
+	if (seq != NULL)
+		memset (seq, 0, cap * sizeof *seq);
+}
+
+/* Appends up to CNT elements from ELEMS to RB, as many as fit.
+   Returns the number of elements appended. */
+size_t
+ringbuf_push (struct ringbuf *rb, const void *elems, size_t cnt) {
+	if (cnt == 0)
+		return 0;
+	return rb->seq == NULL ? push_spsc (rb, elems, cnt)
+		: push_mpsc (rb, elems, cnt);
+}
+
+/* Removes up to CNT of the oldest elements from RB into ELEMS, as
+   many as RB holds.  Returns the number of elements removed. */
+size_t
+ringbuf_pop (struct ringbuf *rb, void *elems, size_t cnt) {
+	uint32_t tail = rb->tail;
+	uint32_t avail = __atomic_load_n (&rb->head, __ATOMIC_ACQUIRE) - tail;
+
+	if (cnt > avail)
+		cnt = avail;
+	if (rb->seq != NULL) {
+		/* Stop at the first slot whose producer is still filling
+		   it in. */
+		size_t i;
+
+		for (i = 0; i < cnt; i++) {
+			uint32_t pos = tail + i;
+			if (__atomic_load_n (&rb->seq[pos & (rb->cap - 1)],
+						__ATOMIC_ACQUIRE) != pos + 1)
+				break;
+		}
+		cnt = i;
+	}
+	if (cnt == 0)
+		return 0;
+
+	copy_out (rb, tail, elems, cnt);
+	__atomic_store_n (&rb->tail, tail + cnt, __ATOMIC_RELEASE);
+	return cnt;
+}
+
+/* Returns the number of elements in RB, or at least how many there
+   were at some point during the call. */
+size_t
+ringbuf_count (const struct ringbuf *rb) {
+	uint32_t tail = __atomic_load_n (&rb->tail, __ATOMIC_ACQUIRE);
+	return __atomic_load_n (&rb->head, __ATOMIC_ACQUIRE) - tail;
+}
+
+/* Returns the number of elements RB can hold. */
+size_t
+ringbuf_capacity (const struct ringbuf *rb) {
+	return rb->cap;
+}
+
+/* Returns true if RB holds no elements. */
+bool
+ringbuf_empty (const struct ringbuf *rb) {
+	return ringbuf_count (rb) == 0;
+}
+
+/* Returns true if RB has no room for another element. */
+bool
+ringbuf_full (const struct ringbuf *rb) {
+	return ringbuf_count (rb) >= rb->cap;
+}
+
+/* ringbuf_push() for a ring with a single producer. */
+static size_t
+push_spsc (struct ringbuf *rb, const void *elems, size_t cnt) {
+	uint32_t head = rb->head;
+	uint32_t room = rb->cap - (head - __atomic_load_n (&rb->tail,
+				__ATOMIC_ACQUIRE));
+
+	if (cnt > room)
+		cnt = room;
+	if (cnt == 0)
+		return 0;
+
+	copy_in (rb, head, elems, cnt);
+	__atomic_store_n (&rb->head, head + cnt, __ATOMIC_RELEASE);
+	return cnt;
+}
+
+/* ringbuf_push() for a ring with several producers. */
+static size_t
+push_mpsc (struct ringbuf *rb, const void *elems, size_t cnt) {
+	uint32_t head = __atomic_load_n (&rb->head, __ATOMIC_RELAXED);
+	uint32_t n;
+	size_t i;
+
+	/* Claim N slots from HEAD on. */
+	do {
+		uint32_t room = rb->cap - (head - __atomic_load_n (&rb->tail,
+					__ATOMIC_ACQUIRE));
+		n = cnt < room ? cnt : room;
+		if (n == 0)
+			return 0;
+	} while (!__atomic_compare_exchange_n (&rb->head, &head, head + n,
+				false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+	copy_in (rb, head, elems, n);
+	for (i = 0; i < n; i++) {
+		uint32_t pos = head + i;
+		__atomic_store_n (&rb->seq[pos & (rb->cap - 1)], pos + 1,
+				__ATOMIC_RELEASE);
+	}
+	return n;
+}
+
+/* Copies CNT elements from ELEMS into RB's slots from POS on. */
+static void
+copy_in (struct ringbuf *rb, uint32_t pos, const void *elems, size_t cnt) {
+	size_t ofs = pos & (rb->cap - 1);
+	size_t run = rb->cap - ofs < cnt ? rb->cap - ofs : cnt;
+
+	memcpy (rb->buf + ofs * rb->elem_size, elems, run * rb->elem_size);
+	memcpy (rb->buf, (const uint8_t *) elems + run * rb->elem_size,
+			(cnt - run) * rb->elem_size);
+}
+
+/* Copies CNT elements from RB's slots from POS on into ELEMS. */
+static void
+copy_out (const struct ringbuf *rb, uint32_t pos, void *elems, size_t cnt) {
+	size_t ofs = pos & (rb->cap - 1);
+	size_t run = rb->cap - ofs < cnt ? rb->cap - ofs : cnt;
+
+	memcpy (elems, rb->buf + ofs * rb->elem_size, run * rb->elem_size);
+	memcpy ((uint8_t *) elems + run * rb->elem_size, rb->buf,
+			(cnt - run) * rb->elem_size);
+}
@@ -0,0 +1,291 @@
+#include <malloc.h>
+#include <debug.h>
+#include <mutex.h>
+#include <round.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <syscall.h>
+
+/* A heap allocator for user programs.
+ *
+ * Requests of up to 1 kB are rounded up to a size class, a power of
+ * two from 16 bytes.  Each class carves pages into blocks of its size
+ * and keeps the blocks freed since on a free list, so that malloc()
+ * and free() come down to popping and pushing a list element.  Every
+ * page starts with a header naming its class, which free() finds by
+ * rounding the block's address down to the page.
+ *
+ * Anything bigger gets a run of whole pages of its own, with the
+ * header at the start of the run and the block right after it.  Page
+ * runs come from the heap, through sbrk().  A freed run goes on a
+ * free list, kept in address order and merged with its neighbours,
+ * and a free run that ends at the break goes back to the kernel by
+ * moving the break down.  Pages carved into blocks stay with their
+ * class.
+ *
+ * One mutex serializes the allocator, so that the threads of a
+ * process can share it. */
+
+#define PAGE_SIZE 4096
+#define MIN_SHIFT 4                 /* Smallest class: 16 bytes. */
+#define CLASS_CNT 7                 /* Classes: 16 bytes to 1 kB. */
+#define RUN_CLASS CLASS_CNT         /* Header class of a page run. */
+#define PAGE_MAGIC 0x48504147       /* Detects bad pointers to free(). */
+
+/* Start of every page of blocks and of every page run. */
+struct page_hdr {
+	uint32_t magic;                 /* PAGE_MAGIC. */
+	uint32_t class;                 /* Size class, or RUN_CLASS. */
+	size_t page_cnt;                /* Pages in a run. */
+	struct page_hdr *next;          /* Next free run, by address. */
+};
+
+/* Blocks start this far into their page, to stay 16-byte aligned. */
+#define HDR_SIZE ROUND_UP (sizeof (struct page_hdr), 16)
+
+/* A free block of a size class. */
+struct free_block {
+	struct free_block *next;
+};
+
+static struct free_block *free_blocks[CLASS_CNT]; /* Free blocks. */
+static struct page_hdr *free_runs;  /* Free page runs, by address. */
+static struct mutex heap_lock;     /* Held while touching the above. */
+
+static void lock (void);
+static void unlock (void);
+static struct page_hdr *run_alloc (size_t page_cnt);
+static void run_free (struct page_hdr *);
+static bool refill (int class);
+static int size_class (size_t size);
+static size_t block_size (const struct page_hdr *);
+
+/* Returns a new block of at least SIZE bytes, 16-byte aligned, or a
+ * null pointer if SIZE is 0 or the heap cannot grow. */
+void *
+malloc (size_t size) {
+	struct page_hdr *run;
+	int class;
+	void *p = NULL;
+
+	if (size == 0)
+		return NULL;
+
+	lock ();
+	class = size_class (size);
+	if (class >= 0) {
+		if (free_blocks[class] != NULL || refill (class)) {
+			struct free_block *b = free_blocks[class];
+			free_blocks[class] = b->next;
+			p = b;
+		}
+	} else if (size <= SIZE_MAX - HDR_SIZE - PAGE_SIZE) {
+		run = run_alloc (DIV_ROUND_UP (size + HDR_SIZE, PAGE_SIZE));
+		if (run != NULL)
+			p = (uint8_t *) run + HDR_SIZE;
+	}
+	unlock ();
+	return p;
+}
+
+/* Returns a new block of A * B bytes, all zero, or a null pointer if
+ * the product is 0, overflows, or cannot be allocated. */
+void *
+calloc (size_t a, size_t b) {
+	void *p;
+
+	if (b != 0 && a > SIZE_MAX / b)
+		return NULL;
+	p = malloc (a * b);
+	if (p != NULL)
+		memset (p, 0, a * b);
+	return p;
+}
+
+/* Resizes block OLD_BLOCK to NEW_SIZE bytes, moving it if needed.
+ * Returns the new block, or a null pointer on failure, which leaves
+ * OLD_BLOCK alone.  A null OLD_BLOCK is like malloc(), and a NEW_SIZE
+ * of 0 like free(). */
+void *
+realloc (void *old_block, size_t new_size) {
+	struct page_hdr *hdr;
+	size_t old_size;
+	void *new_block;
+
+	if (old_block == NULL)
+		return malloc (new_size);
+	if (new_size == 0) {
+		free (old_block);
+		return NULL;
+	}
+
+	hdr = (struct page_hdr *) ROUND_DOWN ((uintptr_t) old_block, PAGE_SIZE);
+	ASSERT (hdr->magic == PAGE_MAGIC);
+	old_size = block_size (hdr);
+	if (new_size <= old_size && (hdr->class == RUN_CLASS
+				|| size_class (new_size) == (int) hdr->class))
+		return old_block;
+
+	new_block = malloc (new_size);
+	if (new_block != NULL) {
+		memcpy (new_block, old_block, old_size < new_size ? old_size : new_size);
+		free (old_block);
+	}
+	return new_block;
+}
+
+/* Frees block P, which must have come from malloc(), calloc() or
+ * realloc() and not been freed since.  A null P does nothing. */
+void
+free (void *p) {
+	struct page_hdr *hdr;
+
+	if (p == NULL)
+		return;
+
+	hdr = (struct page_hdr *) ROUND_DOWN ((uintptr_t) p, PAGE_SIZE);
+	ASSERT (hdr->magic == PAGE_MAGIC);
+	lock ();
+	if (hdr->class == RUN_CLASS)
+		run_free (hdr);
+	else {
+		struct free_block *b = p;
+		b->next = free_blocks[hdr->class];
+		free_blocks[hdr->class] = b;
+	}
+	unlock ();
+}
+
+static void
+lock (void) {
+	mutex_lock (&heap_lock);
+}
+
+static void
+unlock (void) {
+	mutex_unlock (&heap_lock);
+}
+
+/* Returns the size class for SIZE bytes, or -1 if SIZE needs a page
+ * run. */
+static int
+size_class (size_t size) {
+	int class = 0;
+
+	while ((size_t) 1 << (class + MIN_SHIFT) < size)
+		if (++class == CLASS_CNT)
+			return -1;
+	return class;
+}
+
+/* Returns the usable size of the blocks under header HDR. */
+static size_t
+block_size (const struct page_hdr *hdr) {
+	if (hdr->class == RUN_CLASS)
+		return hdr->page_cnt * PAGE_SIZE - HDR_SIZE;
+	return (size_t) 1 << (hdr->class + MIN_SHIFT);
+}
+
+/* Carves a new page into free blocks of CLASS.  Returns false if the
+ * heap cannot grow. */
+static bool
+refill (int class) {
+	size_t size = (size_t) 1 << (class + MIN_SHIFT);
+	struct page_hdr *page = run_alloc (1);
+	uint8_t *b;
+
+	if (page == NULL)
+		return false;
+	page->class = class;
+	for (b = (uint8_t *) page + PAGE_SIZE - size;
+			b >= (uint8_t *) page + HDR_SIZE; b -= size) {
+		struct free_block *fb = (struct free_block *) b;
+		fb->next = free_blocks[class];
+		free_blocks[class] = fb;
+	}
+	return true;
+}
+
+/* Returns a run of PAGE_CNT pages, from the free runs if one is big
+ * enough and otherwise from the end of the heap, or a null pointer if
+ * the heap cannot grow. */
+static struct page_hdr *
+run_alloc (size_t page_cnt) {
+	struct page_hdr **prev, *run;
+	uintptr_t brk;
+
+	/* First fit, splitting off the front of a bigger run. */
+	for (prev = &free_runs; (run = *prev) != NULL; prev = &run->next)
+		if (run->page_cnt >= page_cnt) {
+			if (run->page_cnt == page_cnt)
+				*prev = run->next;
+			else {
+				struct page_hdr *rest = (struct page_hdr *)
+					((uint8_t *) run + page_cnt * PAGE_SIZE);
+				rest->magic = PAGE_MAGIC;
+				rest->class = RUN_CLASS;
+				rest->page_cnt = run->page_cnt - page_cnt;
+				rest->next = run->next;
+				*prev = rest;
+			}
+			break;
+		}
+
+	if (run == NULL) {
+		/* Runs start on page boundaries, whatever else moved the
+		 * break. */
+		brk = (uintptr_t) sbrk (0);
+		if (brk % PAGE_SIZE != 0
+				&& sbrk (PAGE_SIZE - brk % PAGE_SIZE) == (void *) -1)
+			return NULL;
+		if (page_cnt > (size_t) INTPTR_MAX / PAGE_SIZE)
+			return NULL;
+		run = sbrk (page_cnt * PAGE_SIZE);
+		if (run == (void *) -1)
+			return NULL;
+	}
+
+	run->magic = PAGE_MAGIC;
+	run->class = RUN_CLASS;
+	run->page_cnt = page_cnt;
+	run->next = NULL;
+	return run;
+}
+
+/* Puts RUN on the free runs, merging it with its neighbours, and
+ * gives the last free run back to the kernel if it ends at the
+ * break. */
+static void
+run_free (struct page_hdr *run) {
+	struct page_hdr **prev, *next, *before = NULL;
+
+	for (prev = &free_runs; (next = *prev) != NULL && next < run;
+			prev = &next->next)
+		before = next;
+
+	run->next = next;
+	*prev = run;
+	if (next != NULL
+			&& (uint8_t *) run + run->page_cnt * PAGE_SIZE == (uint8_t *) next) {
+		run->page_cnt += next->page_cnt;
+		run->next = next->next;
+	}
+	if (before != NULL
+			&& (uint8_t *) before + before->page_cnt * PAGE_SIZE
+			== (uint8_t *) run) {
+		before->page_cnt += run->page_cnt;
+		before->next = run->next;
+		run = before;
+	}
+
+	/* The break only moves down over the last run. */
+	if (run->next == NULL
+			&& (uint8_t *) run + run->page_cnt * PAGE_SIZE
+			== (uint8_t *) sbrk (0)) {
+		for (prev = &free_runs; *prev != run; prev = &(*prev)->next)
+			continue;
+		*prev = NULL;
+		sbrk (-(intptr_t) (run->page_cnt * PAGE_SIZE));
+	}
+}
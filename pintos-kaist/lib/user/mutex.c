@@ -0,0 +1,74 @@
+#include <mutex.h>
+#include <debug.h>
+
+void
+mutex_init (struct mutex *m) {
+	m->state = 0;
+}
+
+/* Takes M if it is free.  Returns true if successful. */
+bool
+mutex_trylock (struct mutex *m) {
+	int free = 0;
+
+	return __atomic_compare_exchange_n (&m->state, &free, 1, false,
+			__ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+}
+
+/* Takes M, sleeping while another thread holds it. */
+void
+mutex_lock (struct mutex *m) {
+	int c = 0;
+
+	if (__atomic_compare_exchange_n (&m->state, &c, 1, false,
+				__ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+		return;
+
+	/* Whoever holds M now has to wake someone when done.  Having slept
+	 * once, keep it that way, since more may be sleeping. */
+	if (c != 2)
+		c = __atomic_exchange_n (&m->state, 2, __ATOMIC_ACQUIRE);
+	while (c != 0) {
+		futex (&m->state, FUTEX_WAIT, 2);
+		c = __atomic_exchange_n (&m->state, 2, __ATOMIC_ACQUIRE);
+	}
+}
+
+/* Releases M, which the caller holds, waking a waiter if any. */
+void
+mutex_unlock (struct mutex *m) {
+	if (__atomic_exchange_n (&m->state, 0, __ATOMIC_RELEASE) == 2)
+		futex (&m->state, FUTEX_WAKE, 1);
+}
+
+void
+pi_mutex_init (struct pi_mutex *m) {
+	m->owner = 0;
+}
+
+/* Takes M for thread SELF, the caller, sleeping while another thread
+ * holds it. */
+void
+pi_mutex_lock (struct pi_mutex *m, pid_t self) {
+	ASSERT ((__atomic_load_n (&m->owner, __ATOMIC_RELAXED)
+				& ~FUTEX_WAITERS) != self);
+	for (;;) {
+		int free = 0;
+
+		if (__atomic_compare_exchange_n (&m->owner, &free, self, false,
+					__ATOMIC_ACQUIRE, __ATOMIC_RELAXED)
+				|| futex (&m->owner, FUTEX_LOCK_PI, 0) == 0)
+			return;
+	}
+}
+
+/* Releases M, which thread SELF, the caller, holds, handing it to the
+ * waiter of highest priority if any. */
+void
+pi_mutex_unlock (struct pi_mutex *m, pid_t self) {
+	int owner = self;
+
+	if (!__atomic_compare_exchange_n (&m->owner, &owner, 0, false,
+				__ATOMIC_RELEASE, __ATOMIC_RELAXED))
+		futex (&m->owner, FUTEX_UNLOCK_PI, 0);
+}
@@ -1,196 +1,310 @@
-#include <syscall.h>
-#include <stdint.h>
-#include "../syscall-nr.h"
-
-__attribute__((always_inline))
-static __inline int64_t syscall (uint64_t num_, uint64_t a1_, uint64_t a2_,
-		uint64_t a3_, uint64_t a4_, uint64_t a5_, uint64_t a6_) {
-	int64_t ret;
-	register uint64_t *num asm ("rax") = (uint64_t *) num_;
-	register uint64_t *a1 asm ("rdi") = (uint64_t *) a1_;
-	register uint64_t *a2 asm ("rsi") = (uint64_t *) a2_;
-	register uint64_t *a3 asm ("rdx") = (uint64_t *) a3_;
-	register uint64_t *a4 asm ("r10") = (uint64_t *) a4_;
-	register uint64_t *a5 asm ("r8") = (uint64_t *) a5_;
-	register uint64_t *a6 asm ("r9") = (uint64_t *) a6_;
-
-	__asm __volatile(
-			"mov %1, %%rax\n"
-			"mov %2, %%rdi\n"
-			"mov %3, %%rsi\n"
-			"mov %4, %%rdx\n"
-			"mov %5, %%r10\n"
-			"mov %6, %%r8\n"
-			"mov %7, %%r9\n"
-			"syscall\n"
-			: "=a" (ret)
-			: "g" (num), "g" (a1), "g" (a2), "g" (a3), "g" (a4), "g" (a5), "g" (a6)
-			: "cc", "memory");
-	return ret;
-}
-
-/* 시스템 콜 번호 NUMBER를 호출하며 인자는 전달하지 않고,
-그 반환 값을 정수로 반환한다. `int'. */
-#define syscall0(NUMBER) ( \
-		syscall(((uint64_t) NUMBER), 0, 0, 0, 0, 0, 0))
-
-/* 시스템 콜 번호 NUMBER를 호출하면서 인자 ARG0을 전달하고,
-그 반환 값을 정수로 반환한다. `int'. */
-#define syscall1(NUMBER, ARG0) ( \
-		syscall(((uint64_t) NUMBER), \
-			((uint64_t) ARG0), 0, 0, 0, 0, 0))
-/* 시스템 콜 번호 NUMBER를 호출하면서 인자 ARG0과 ARG1을 전달하고,
-그 반환 값을 int형으로 반환한다. */
-#define syscall2(NUMBER, ARG0, ARG1) ( \
-		syscall(((uint64_t) NUMBER), \
-			((uint64_t) ARG0), \
-			((uint64_t) ARG1), \
-			0, 0, 0, 0))
-
-#define syscall3(NUMBER, ARG0, ARG1, ARG2) ( \
-		syscall(((uint64_t) NUMBER), \
-			((uint64_t) ARG0), \
-			((uint64_t) ARG1), \
-			((uint64_t) ARG2), 0, 0, 0))
-
-#define syscall4(NUMBER, ARG0, ARG1, ARG2, ARG3) ( \
-		syscall(((uint64_t *) NUMBER), \
-			((uint64_t) ARG0), \
-			((uint64_t) ARG1), \
-			((uint64_t) ARG2), \
-			((uint64_t) ARG3), 0, 0))
-
-#define syscall5(NUMBER, ARG0, ARG1, ARG2, ARG3, ARG4) ( \
-		syscall(((uint64_t) NUMBER), \
-			((uint64_t) ARG0), \
-			((uint64_t) ARG1), \
-			((uint64_t) ARG2), \
-			((uint64_t) ARG3), \
-			((uint64_t) ARG4), \
-			0))
-void
-halt (void) {	//power_off()대신 사용해야 하는 것?
-	syscall0 (SYS_HALT);
-	NOT_REACHED ();
-}
-
-void
-exit (int status) {	//현재 동작중인 유저 프로그램을 종료한다.
-	syscall1 (SYS_EXIT, status);
-	NOT_REACHED ();
-}
-
-pid_t
-fork (const char *thread_name){
-	return (pid_t) syscall1 (SYS_FORK, thread_name);
-}
-
-int
-exec (const char *file) {
-	return (pid_t) syscall1 (SYS_EXEC, file);
-}
-
-int
-wait (pid_t pid) {
-	return syscall1 (SYS_WAIT, pid);
-}
-
-bool
-create (const char *file, unsigned initial_size) {
-	return syscall2 (SYS_CREATE, file, initial_size);
-}
-
-bool
-remove (const char *file) {
-	return syscall1 (SYS_REMOVE, file);
-}
-
-int
-open (const char *file) {
-	return syscall1 (SYS_OPEN, file);
-}
-
-int
-filesize (int fd) {
-	return syscall1 (SYS_FILESIZE, fd);
-}
-
-int
-read (int fd, void *buffer, unsigned size) {
-	return syscall3 (SYS_READ, fd, buffer, size);
-}
-
-int
-write (int fd, const void *buffer, unsigned size) {
-	return syscall3 (SYS_WRITE, fd, buffer, size);
-}
-
-void
-seek (int fd, unsigned position) {
-	syscall2 (SYS_SEEK, fd, position);
-}
-
-unsigned
-tell (int fd) {
-	return syscall1 (SYS_TELL, fd);
-}
-
-void
-close (int fd) {
-	syscall1 (SYS_CLOSE, fd);
-}
-
-int
-dup2 (int oldfd, int newfd){
-	return syscall2 (SYS_DUP2, oldfd, newfd);
-}
-
-void *
-mmap (void *addr, size_t length, int writable, int fd, off_t offset) {
-	return (void *) syscall5 (SYS_MMAP, addr, length, writable, fd, offset);
-}
-
-void
-munmap (void *addr) {
-	syscall1 (SYS_MUNMAP, addr);
-}
-
-bool
-chdir (const char *dir) {
-	return syscall1 (SYS_CHDIR, dir);
-}
-
-bool
-mkdir (const char *dir) {
-	return syscall1 (SYS_MKDIR, dir);
-}
-
-bool
-readdir (int fd, char name[READDIR_MAX_LEN + 1]) {
-	return syscall2 (SYS_READDIR, fd, name);
-}
-
-bool
-isdir (int fd) {
-	return syscall1 (SYS_ISDIR, fd);
-}
-
-int
-inumber (int fd) {
-	return syscall1 (SYS_INUMBER, fd);
-}
-
-int
-symlink (const char* target, const char* linkpath) {
-	return syscall2 (SYS_SYMLINK, target, linkpath);
-}
-
-int
-mount (const char *path, int chan_no, int dev_no) {
-	return syscall3 (SYS_MOUNT, path, chan_no, dev_no);
-}
-
-int
-umount (const char *path) {
-	return syscall1 (SYS_UMOUNT, path);
-}
+#include <syscall.h>
+#include <stdint.h>
+#include "../syscall-nr.h"
+
+__attribute__((always_inline))
+static __inline int64_t syscall (uint64_t num_, uint64_t a1_, uint64_t a2_,
+		uint64_t a3_, uint64_t a4_, uint64_t a5_, uint64_t a6_) {
+	int64_t ret;
+	register uint64_t *num asm ("rax") = (uint64_t *) num_;
+	register uint64_t *a1 asm ("rdi") = (uint64_t *) a1_;
+	register uint64_t *a2 asm ("rsi") = (uint64_t *) a2_;
+	register uint64_t *a3 asm ("rdx") = (uint64_t *) a3_;
+	register uint64_t *a4 asm ("r10") = (uint64_t *) a4_;
+	register uint64_t *a5 asm ("r8") = (uint64_t *) a5_;
+	register uint64_t *a6 asm ("r9") = (uint64_t *) a6_;
+
+	__asm __volatile(
+			"mov %1, %%rax\n"
+			"mov %2, %%rdi\n"
+			"mov %3, %%rsi\n"
+			"mov %4, %%rdx\n"
+			"mov %5, %%r10\n"
+			"mov %6, %%r8\n"
+			"mov %7, %%r9\n"
+			"syscall\n"
+			: "=a" (ret)
+			: "g" (num), "g" (a1), "g" (a2), "g" (a3), "g" (a4), "g" (a5), "g" (a6)
+			: "cc", "memory");
+	return ret;
+}
+
+/* 시스템 콜 번호 NUMBER를 호출하며 인자는 전달하지 않고,
+그 반환 값을 정수로 반환한다. `int'. */
+#define syscall0(NUMBER) ( \
+		syscall(((uint64_t) NUMBER), 0, 0, 0, 0, 0, 0))
+
+/* 시스템 콜 번호 NUMBER를 호출하면서 인자 ARG0을 전달하고,
+그 반환 값을 정수로 반환한다. `int'. */
+#define syscall1(NUMBER, ARG0) ( \
+		syscall(((uint64_t) NUMBER), \
+			((uint64_t) ARG0), 0, 0, 0, 0, 0))
+/* 시스템 콜 번호 NUMBER를 호출하면서 인자 ARG0과 ARG1을 전달하고,
+그 반환 값을 int형으로 반환한다. */
+#define syscall2(NUMBER, ARG0, ARG1) ( \
+		syscall(((uint64_t) NUMBER), \
+			((uint64_t) ARG0), \
+			((uint64_t) ARG1), \
+			0, 0, 0, 0))
+
+#define syscall3(NUMBER, ARG0, ARG1, ARG2) ( \
+		syscall(((uint64_t) NUMBER), \
+			((uint64_t) ARG0), \
+			((uint64_t) ARG1), \
+			((uint64_t) ARG2), 0, 0, 0))
+
+#define syscall4(NUMBER, ARG0, ARG1, ARG2, ARG3) ( \
+		syscall(((uint64_t) NUMBER), \
+			((uint64_t) ARG0), \
+			((uint64_t) ARG1), \
+			((uint64_t) ARG2), \
+			((uint64_t) ARG3), 0, 0))
+
+#define syscall5(NUMBER, ARG0, ARG1, ARG2, ARG3, ARG4) ( \
+		syscall(((uint64_t) NUMBER), \
+			((uint64_t) ARG0), \
+			((uint64_t) ARG1), \
+			((uint64_t) ARG2), \
+			((uint64_t) ARG3), \
+			((uint64_t) ARG4), \
+			0))
+void
+halt (void) {	//power_off()대신 사용해야 하는 것?
+	syscall0 (SYS_HALT);
+	NOT_REACHED ();
+}
+
+void
+exit (int status) {	//현재 동작중인 유저 프로그램을 종료한다.
+	syscall1 (SYS_EXIT, status);
+	NOT_REACHED ();
+}
+
+pid_t
+fork (const char *thread_name){
+	return (pid_t) syscall1 (SYS_FORK, thread_name);
+}
+
+int
+exec (const char *file) {
+	return (pid_t) syscall1 (SYS_EXEC, file);
+}
+
+int
+wait (pid_t pid) {
+	return syscall1 (SYS_WAIT, pid);
+}
+
+bool
+create (const char *file, unsigned initial_size) {
+	return syscall2 (SYS_CREATE, file, initial_size);
+}
+
+bool
+remove (const char *file) {
+	return syscall1 (SYS_REMOVE, file);
+}
+
+int
+open (const char *file) {
+	return syscall1 (SYS_OPEN, file);
+}
+
+int
+filesize (int fd) {
+	return syscall1 (SYS_FILESIZE, fd);
+}
+
+int
+read (int fd, void *buffer, unsigned size) {
+	return syscall3 (SYS_READ, fd, buffer, size);
+}
+
+int
+write (int fd, const void *buffer, unsigned size) {
+	return syscall3 (SYS_WRITE, fd, buffer, size);
+}
+
+void
+seek (int fd, unsigned position) {
+	syscall2 (SYS_SEEK, fd, position);
+}
+
+unsigned
+tell (int fd) {
+	return syscall1 (SYS_TELL, fd);
+}
+
+void
+close (int fd) {
+	syscall1 (SYS_CLOSE, fd);
+}
+
+int
+dup2 (int oldfd, int newfd){
+	return syscall2 (SYS_DUP2, oldfd, newfd);
+}
+
+int
+pipe (int fds[2]) {
+	return syscall1 (SYS_PIPE, fds);
+}
+
+pid_t
+spawn (const char *cmd_line, const struct spawn_action *actions,
+		int action_cnt) {
+	return syscall3 (SYS_SPAWN, cmd_line, actions, action_cnt);
+}
+
+int
+brk (void *addr) {
+	return syscall1 (SYS_BRK, addr);
+}
+
+void *
+sbrk (intptr_t increment) {
+	return (void *) syscall1 (SYS_SBRK, increment);
+}
+
+/* Where a thread from thread_spawn() starts. */
+static void
+thread_start (void (*func) (void *), void *aux) {
+	func (aux);
+	syscall1 (SYS_THREAD_EXIT, 0);
+	NOT_REACHED ();
+}
+
+pid_t
+thread_spawn (void (*func) (void *), void *aux) {
+	return (pid_t) syscall3 (SYS_THREAD_SPAWN, thread_start, func, aux);
+}
+
+int
+thread_join (pid_t tid) {
+	return syscall1 (SYS_THREAD_JOIN, tid);
+}
+
+pid_t
+gettid (void) {
+	return (pid_t) syscall0 (SYS_GETTID);
+}
+
+int
+futex (int *addr, int op, int val) {
+	return syscall3 (SYS_FUTEX, addr, op, val);
+}
+
+int
+fcntl (int fd, int cmd, int arg) {
+	return syscall3 (SYS_FCNTL, fd, cmd, arg);
+}
+
+int
+poll (struct pollfd *fds, int nfds, int timeout_ms) {
+	return syscall3 (SYS_POLL, fds, nfds, timeout_ms);
+}
+
+int
+dmesg (char *buf, unsigned size) {
+	return syscall2 (SYS_DMESG, buf, size);
+}
+
+int
+shm_open (size_t size) {
+	return syscall1 (SYS_SHM_OPEN, size);
+}
+
+void *
+shm_map (int fd, void *addr, bool writable) {
+	return (void *) syscall3 (SYS_SHM_MAP, fd, addr, writable);
+}
+
+int
+shm_unmap (void *addr, size_t size) {
+	return syscall2 (SYS_SHM_UNMAP, addr, size);
+}
+
+int
+pread (int fd, void *buffer, unsigned size, off_t offset) {
+	return syscall4 (SYS_PREAD, fd, buffer, size, offset);
+}
+
+int
+pwrite (int fd, const void *buffer, unsigned size, off_t offset) {
+	return syscall4 (SYS_PWRITE, fd, buffer, size, offset);
+}
+
+int
+readv (int fd, const struct iovec *iov, int iovcnt) {
+	return syscall3 (SYS_READV, fd, iov, iovcnt);
+}
+
+int
+writev (int fd, const struct iovec *iov, int iovcnt) {
+	return syscall3 (SYS_WRITEV, fd, iov, iovcnt);
+}
+
+int
+ring_setup (void *addr, unsigned entries) {
+	return syscall2 (SYS_RING_SETUP, addr, entries);
+}
+
+int
+ring_enter (unsigned to_submit) {
+	return syscall1 (SYS_RING_ENTER, to_submit);
+}
+
+int
+syscall_stats (int nr, bool global, struct syscall_stat *st) {
+	return syscall3 (SYS_SYSCALL_STATS, nr, global, st);
+}
+
+void *
+mmap (void *addr, size_t length, int writable, int fd, off_t offset) {
+	return (void *) syscall5 (SYS_MMAP, addr, length, writable, fd, offset);
+}
+
+void
+munmap (void *addr) {
+	syscall1 (SYS_MUNMAP, addr);
+}
+
+bool
+chdir (const char *dir) {
+	return syscall1 (SYS_CHDIR, dir);
+}
+
+bool
+mkdir (const char *dir) {
+	return syscall1 (SYS_MKDIR, dir);
+}
+
+bool
+readdir (int fd, char name[READDIR_MAX_LEN + 1]) {
+	return syscall2 (SYS_READDIR, fd, name);
+}
+
+bool
+isdir (int fd) {
+	return syscall1 (SYS_ISDIR, fd);
+}
+
+int
+inumber (int fd) {
+	return syscall1 (SYS_INUMBER, fd);
+}
+
+int
+symlink (const char* target, const char* linkpath) {
+	return syscall2 (SYS_SYMLINK, target, linkpath);
+}
+
+int
+mount (const char *path, int chan_no, int dev_no) {
+	return syscall3 (SYS_MOUNT, path, chan_no, dev_no);
+}
+
+int
+umount (const char *path) {
+	return syscall1 (SYS_UMOUNT, path);
+}
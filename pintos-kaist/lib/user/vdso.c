@@ -0,0 +1,67 @@
+#include <syscall.h>
+#include <stdint.h>
+#include <vdso.h>
+
+/* Readers of the vDSO pages (see lib/vdso.h).  None of these enter the
+ * kernel. */
+
+#define NSEC_PER_SEC 1000000000LL
+
+static inline uint64_t
+rdtsc (void) {
+	uint32_t lo, hi;
+	asm volatile ("rdtsc" : "=a" (lo), "=d" (hi));
+	return ((uint64_t) hi << 32) | lo;
+}
+
+/* Stores the current time, as nanoseconds since boot, in TS.  The time
+ * advances in timer ticks, interpolated with the time stamp counter
+ * between ticks once the kernel has measured its rate.  Returns 0. */
+int
+clock_gettime (struct timespec *ts) {
+	const volatile struct vdso_time *vt =
+		(const volatile struct vdso_time *) VDSO_ADDR;
+	int64_t ticks, ns_per_tick, ns;
+	uint64_t tsc, tsc_per_tick, now;
+
+	for (;;) {
+		uint32_t seq = __atomic_load_n (&vt->seq, __ATOMIC_ACQUIRE);
+		if (seq & 1)
+			continue;
+		ticks = vt->ticks;
+		tsc = vt->tsc;
+		tsc_per_tick = vt->tsc_per_tick;
+		ns_per_tick = NSEC_PER_SEC / vt->freq;
+		now = rdtsc ();
+		__atomic_thread_fence (__ATOMIC_ACQUIRE);
+		if (vt->seq == seq)
+			break;
+	}
+
+	ns = ticks * ns_per_tick;
+	if (tsc_per_tick != 0) {
+		/* Never run past the next tick, which would make time go
+		 * backwards when it arrives. */
+		uint64_t delta = now - tsc;
+		if (delta >= tsc_per_tick)
+			delta = tsc_per_tick - 1;
+		ns += delta * ns_per_tick / tsc_per_tick;
+	}
+	ts->tv_sec = ns / NSEC_PER_SEC;
+	ts->tv_nsec = ns % NSEC_PER_SEC;
+	return 0;
+}
+
+/* Returns the number of timer ticks since boot. */
+int64_t
+clock_ticks (void) {
+	const volatile struct vdso_time *vt =
+		(const volatile struct vdso_time *) VDSO_ADDR;
+	return vt->ticks;
+}
+
+/* Returns the current process's pid. */
+pid_t
+getpid (void) {
+	return ((const volatile struct vdso_proc *) VDSO_PROC_ADDR)->pid;
+}
@@ -1,5 +1,5 @@
-/* Tests that create properly zeros out the contents of a fairly
-   small file. */
-
-#define TEST_SIZE 5678
-#include "tests/filesys/create.inc"
+/* Tests that create properly zeros out the contents of a fairly
+   small file. */
+
+#define TEST_SIZE 5678
+#include "tests/filesys/create.inc"
@@ -1,6 +1,6 @@
-# -*- perl -*-
-use strict;
-use warnings;
-use tests::tests;
-check_archive ({"xyzzy" => {}});
-pass;
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+check_archive ({"xyzzy" => {}});
+pass;
@@ -1,13 +1,13 @@
-/* Tries to create a file with the same name as an existing
-   directory, which must return failure. */
-
-#include <syscall.h>
-#include "tests/lib.h"
-#include "tests/main.h"
-
-void
-test_main (void) 
-{
-  CHECK (mkdir ("abc"), "mkdir \"abc\"");
-  CHECK (!create ("abc", 0), "create \"abc\" (must return false)");
-}
+/* Tries to create a file with the same name as an existing
+   directory, which must return failure. */
+
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+void
+test_main (void) 
+{
+  CHECK (mkdir ("abc"), "mkdir \"abc\"");
+  CHECK (!create ("abc", 0), "create \"abc\" (must return false)");
+}
@@ -1,4 +1,4 @@
-/* Create a file of size 0. */
-
-#define TEST_SIZE 0
-#include "tests/filesys/create.inc"
+/* Create a file of size 0. */
+
+#define TEST_SIZE 0
+#include "tests/filesys/create.inc"
@@ -1,4 +1,4 @@
-# -*- perl -*-
-use tests::tests;
-use tests::threads::alarm;
-check_alarm (7);
+# -*- perl -*-
+use tests::tests;
+use tests::threads::alarm;
+check_alarm (7);
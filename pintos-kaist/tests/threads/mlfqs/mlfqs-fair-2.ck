@@ -1,7 +1,7 @@
-# -*- perl -*-
-use strict;
-use warnings;
-use tests::tests;
-use tests::threads::mlfqs;
-
-check_mlfqs_fair ([0, 0], 50);
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+use tests::threads::mlfqs;
+
+check_mlfqs_fair ([0, 0], 50);
@@ -1,13 +1,13 @@
-/* This program attempts to execute code at address 0, which is not mapped.
-   This should terminate the process with a -1 exit code. */
-
-#include "tests/lib.h"
-#include "tests/main.h"
-
-void
-test_main (void) 
-{
-  msg ("Congratulations - you have successfully called NULL: %d", 
-        ((int (*)(void))NULL)());
-  fail ("should have exited with -1");
-}
+/* This program attempts to execute code at address 0, which is not mapped.
+   This should terminate the process with a -1 exit code. */
+
+#include "tests/lib.h"
+#include "tests/main.h"
+
+void
+test_main (void) 
+{
+  msg ("Congratulations - you have successfully called NULL: %d", 
+        ((int (*)(void))NULL)());
+  fail ("should have exited with -1");
+}
@@ -1,13 +1,13 @@
-/* This program attempts to read kernel memory. 
-   This should terminate the process with a -1 exit code. */
-
-#include "tests/lib.h"
-#include "tests/main.h"
-
-void
-test_main (void) 
-{
-  msg ("Congratulations - you have successfully read kernel memory: %d", 
-        *(int *)0x8004000000);
-  fail ("should have exited with -1");
-}
+/* This program attempts to read kernel memory. 
+   This should terminate the process with a -1 exit code. */
+
+#include "tests/lib.h"
+#include "tests/main.h"
+
+void
+test_main (void) 
+{
+  msg ("Congratulations - you have successfully read kernel memory: %d", 
+        *(int *)0x8004000000);
+  fail ("should have exited with -1");
+}
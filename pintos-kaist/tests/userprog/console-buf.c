@@ -0,0 +1,46 @@
+/* Writes console output in pieces that the kernel buffers, and
+   checks that it comes out whole and in order: a line written in
+   several pieces, a partial line left pending across a fork, and a
+   write bigger than the kernel's buffer. */
+
+#include <stdio.h>
+#include <string.h>
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+static void
+put (const char *s)
+{
+  write (STDOUT_FILENO, s, strlen (s));
+}
+
+void
+test_main (void)
+{
+  char big[600];
+  size_t i;
+  pid_t pid;
+
+  put ("(console-buf) a line");
+  put (" written");
+  put (" in pieces\n");
+
+  /* The parent's partial line must come out before anything the
+     child writes. */
+  put ("(console-buf) before fork, ");
+  pid = fork ("child");
+  if (pid == 0)
+    {
+      put ("then the child\n");
+      exit (0);
+    }
+  CHECK (wait (pid) == 0, "wait for child");
+
+  memcpy (big, "(console-buf) ", 14);
+  for (i = 14; i < sizeof big - 1; i++)
+    big[i] = 'x';
+  big[sizeof big - 1] = '\n';
+  write (STDOUT_FILENO, big, sizeof big);
+  put ("(console-buf) two lines\n(console-buf) in one write\n");
+}
@@ -1,10 +1,10 @@
-/* Creates an ordinary empty file. */
-
-#include "tests/lib.h"
-#include "tests/main.h"
-
-void
-test_main (void) 
-{
-  CHECK (create ("quux.dat", 0), "create quux.dat");
-}
+/* Creates an ordinary empty file. */
+
+#include "tests/lib.h"
+#include "tests/main.h"
+
+void
+test_main (void) 
+{
+  CHECK (create ("quux.dat", 0), "create quux.dat");
+}
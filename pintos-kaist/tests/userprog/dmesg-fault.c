@@ -0,0 +1,30 @@
+/* Has a child process fault on a null pointer, and checks that the
+   kernel logged the fault where dmesg() can read it back. */
+
+#include <string.h>
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+static char buf[16384];
+
+void
+test_main (void)
+{
+  pid_t pid;
+  int n;
+
+  pid = fork ("child");
+  if (pid == 0)
+    {
+      volatile int *p = NULL;
+      exit (*p);
+    }
+  CHECK (wait (pid) == -1, "wait for faulting child");
+
+  n = dmesg (buf, sizeof buf - 1);
+  CHECK (n > 0 && buf[n - 1] == '\n', "read the kernel log");
+  buf[n] = '\0';
+  CHECK (strstr (buf, "child: page fault at") != NULL, "fault was logged");
+  CHECK (dmesg (buf, 1) == 0, "no partial records");
+}
@@ -0,0 +1,13 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+check_expected (IGNORE_EXIT_CODES => 1, [<<'EOF']);
+(dmesg-fault) begin
+(dmesg-fault) wait for faulting child
+(dmesg-fault) read the kernel log
+(dmesg-fault) fault was logged
+(dmesg-fault) no partial records
+(dmesg-fault) end
+EOF
+pass;
@@ -1,12 +1,12 @@
-/* Tests argument passing to child processes. */
-
-#include <syscall.h>
-#include "tests/lib.h"
-#include "tests/main.h"
-
-void
-test_main (void) 
-{
-  msg ("I'm your father");
-  exec ("child-args childarg");
-}
+/* Tests argument passing to child processes. */
+
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+void
+test_main (void) 
+{
+  msg ("I'm your father");
+  exec ("child-args childarg");
+}
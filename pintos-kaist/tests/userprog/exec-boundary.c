@@ -1,20 +1,20 @@
-/* Forks a thread whose name spans the boundary between two pages.
-   This is valid, so it must succeed. */
-
-#include <syscall.h>
-#include "tests/userprog/boundary.h"
-#include "tests/lib.h"
-#include "tests/main.h"
-
-void
-test_main (void) 
-{
-  pid_t pid = fork ("child-simple");
-  if (pid == 0){
-    exec (copy_string_across_boundary ("child-simple"));
-  } else {
-    int exit_val = wait(pid);
-    CHECK (pid > 0, "fork");
-    CHECK (exit_val == 81, "wait");
-  }
-}
+/* Forks a thread whose name spans the boundary between two pages.
+   This is valid, so it must succeed. */
+
+#include <syscall.h>
+#include "tests/userprog/boundary.h"
+#include "tests/lib.h"
+#include "tests/main.h"
+
+void
+test_main (void) 
+{
+  pid_t pid = fork ("child-simple");
+  if (pid == 0){
+    exec (copy_string_across_boundary ("child-simple"));
+  } else {
+    int exit_val = wait(pid);
+    CHECK (pid > 0, "fork");
+    CHECK (exit_val == 81, "wait");
+  }
+}
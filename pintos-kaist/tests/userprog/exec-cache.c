@@ -0,0 +1,44 @@
+/* Runs child-simple twice, so that the second run can come from the
+   exec cache, then overwrites its ELF header and checks that the next
+   spawn() notices.  Puts the header back and runs it once more. */
+
+#include <string.h>
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+static void
+run_child (const char *what)
+{
+  pid_t pid = spawn ("child-simple", NULL, 0);
+  if (pid == PID_ERROR)
+    fail ("%s: spawn failed", what);
+  if (wait (pid) != 81)
+    fail ("%s: wrong exit status", what);
+  msg ("%s", what);
+}
+
+void
+test_main (void)
+{
+  char header[64], junk[sizeof header];
+  int fd;
+
+  run_child ("first run");
+  run_child ("second run");
+
+  CHECK ((fd = open ("child-simple")) > 1, "open \"child-simple\"");
+  CHECK (read (fd, header, sizeof header) == sizeof header,
+         "read ELF header");
+  memset (junk, 0xcc, sizeof junk);
+  seek (fd, 0);
+  CHECK (write (fd, junk, sizeof junk) == sizeof junk,
+         "overwrite ELF header");
+  CHECK (spawn ("child-simple", NULL, 0) == PID_ERROR, "spawn fails");
+
+  seek (fd, 0);
+  CHECK (write (fd, header, sizeof header) == sizeof header,
+         "restore ELF header");
+  close (fd);
+  run_child ("third run");
+}
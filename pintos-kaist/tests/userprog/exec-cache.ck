@@ -0,0 +1,21 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+check_expected (IGNORE_EXIT_CODES => 1, [<<'EOF']);
+(exec-cache) begin
+(child-simple) run
+(exec-cache) first run
+(child-simple) run
+(exec-cache) second run
+(exec-cache) open "child-simple"
+(exec-cache) read ELF header
+(exec-cache) overwrite ELF header
+load: child-simple: error loading executable
+(exec-cache) spawn fails
+(exec-cache) restore ELF header
+(child-simple) run
+(exec-cache) third run
+(exec-cache) end
+EOF
+pass;
@@ -1,12 +1,12 @@
-/* Executes and waits for a single child process. */
-
-#include <syscall.h>
-#include "tests/lib.h"
-#include "tests/main.h"
-
-void
-test_main (void) 
-{
-  msg ("I'm your father");
-  exec ("child-simple");
-}
+/* Executes and waits for a single child process. */
+
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+void
+test_main (void) 
+{
+  msg ("I'm your father");
+  exec ("child-simple");
+}
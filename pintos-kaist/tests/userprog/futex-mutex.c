@@ -0,0 +1,68 @@
+/* Checks that a futex-based mutex stays out of the kernel while
+   uncontended, and keeps threads that fight over it in order. */
+
+#include <mutex.h>
+#include <syscall.h>
+#include <syscall-nr.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+#define THREADS 4
+#define ROUNDS 20000
+
+static struct mutex m = MUTEX_INITIALIZER;
+static volatile long long counter;
+
+static void
+add (void *aux UNUSED)
+{
+  int i;
+
+  for (i = 0; i < ROUNDS; i++)
+    {
+      mutex_lock (&m);
+      counter = counter + 1;
+      mutex_unlock (&m);
+    }
+}
+
+void
+test_main (void)
+{
+  struct syscall_stat before, after;
+  pid_t tids[THREADS];
+  int word = 7;
+  int i;
+
+  CHECK (syscall_stats (SYS_FUTEX, false, &before) == 0,
+         "read own futex() statistics");
+  for (i = 0; i < 1000; i++)
+    {
+      mutex_lock (&m);
+      mutex_unlock (&m);
+    }
+  CHECK (mutex_trylock (&m), "trylock a free mutex");
+  CHECK (!mutex_trylock (&m), "trylock a held mutex fails");
+  mutex_unlock (&m);
+  CHECK (syscall_stats (SYS_FUTEX, false, &after) == 0,
+         "read own futex() statistics again");
+  if (after.count != before.count)
+    fail ("uncontended mutex made %d futex() calls",
+          (int) (after.count - before.count));
+  msg ("uncontended mutex stayed in user mode");
+
+  CHECK (futex (&word, FUTEX_WAIT, 8) == -1, "wait on a changed word fails");
+  CHECK (futex (&word, FUTEX_WAKE, 1) == 0, "wake with no waiters");
+  CHECK (futex ((int *) ((char *) &word + 1), FUTEX_WAKE, 1) == -1,
+         "misaligned word fails");
+
+  for (i = 0; i < THREADS; i++)
+    if ((tids[i] = thread_spawn (add, NULL)) == PID_ERROR)
+      fail ("thread_spawn %d failed", i);
+  for (i = 0; i < THREADS; i++)
+    if (thread_join (tids[i]) != 0)
+      fail ("thread_join %d failed", i);
+  if (counter != (long long) THREADS * ROUNDS)
+    fail ("counter is %lld, not %d", counter, THREADS * ROUNDS);
+  msg ("contended mutex counted right");
+}
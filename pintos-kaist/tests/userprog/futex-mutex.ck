@@ -0,0 +1,18 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+check_expected (IGNORE_EXIT_CODES => 1, [<<'EOF']);
+(futex-mutex) begin
+(futex-mutex) read own futex() statistics
+(futex-mutex) trylock a free mutex
+(futex-mutex) trylock a held mutex fails
+(futex-mutex) read own futex() statistics again
+(futex-mutex) uncontended mutex stayed in user mode
+(futex-mutex) wait on a changed word fails
+(futex-mutex) wake with no waiters
+(futex-mutex) misaligned word fails
+(futex-mutex) contended mutex counted right
+(futex-mutex) end
+EOF
+pass;
@@ -0,0 +1,42 @@
+/* Has the owner of a PI mutex that another thread waits for wipe
+   the mutex word and then lock it again through the kernel, which
+   must fail instead of deadlocking on the kernel's own lock. */
+
+#include <mutex.h>
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+static struct pi_mutex m = PI_MUTEX_INITIALIZER;
+static volatile int got_it;
+
+static void
+waiter (void *aux UNUSED)
+{
+  pid_t self = gettid ();
+
+  pi_mutex_lock (&m, self);
+  got_it = 1;
+  pi_mutex_unlock (&m, self);
+}
+
+void
+test_main (void)
+{
+  pid_t self = gettid (), tid;
+
+  pi_mutex_lock (&m, self);
+  CHECK ((tid = thread_spawn (waiter, NULL)) != PID_ERROR, "spawn waiter");
+  while (!(__atomic_load_n (&m.owner, __ATOMIC_ACQUIRE) & FUTEX_WAITERS))
+    continue;
+
+  m.owner = 0;
+  CHECK (futex (&m.owner, FUTEX_LOCK_PI, 0) == -1,
+         "locking it again over a wiped word fails");
+  CHECK (!got_it, "waiter is still waiting");
+
+  m.owner = self | FUTEX_WAITERS;
+  pi_mutex_unlock (&m, self);
+  CHECK (thread_join (tid) == 0, "join waiter");
+  CHECK (got_it, "waiter got the mutex");
+}
@@ -0,0 +1,14 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+check_expected (IGNORE_EXIT_CODES => 1, [<<'EOF']);
+(futex-pi-clobber) begin
+(futex-pi-clobber) spawn waiter
+(futex-pi-clobber) locking it again over a wiped word fails
+(futex-pi-clobber) waiter is still waiting
+(futex-pi-clobber) join waiter
+(futex-pi-clobber) waiter got the mutex
+(futex-pi-clobber) end
+EOF
+pass;
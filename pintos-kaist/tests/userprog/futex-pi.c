@@ -0,0 +1,61 @@
+/* Makes a thread wait for a PI mutex that the main thread holds,
+   then checks the hand-off, the owner checks, and that the lock of
+   a thread that has exited can be taken over. */
+
+#include <mutex.h>
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+static struct pi_mutex m = PI_MUTEX_INITIALIZER;
+static volatile int got_it;
+static volatile pid_t waiter_tid;
+
+static void
+waiter (void *aux UNUSED)
+{
+  pid_t self = gettid ();
+
+  waiter_tid = self;
+  pi_mutex_lock (&m, self);
+  got_it = 1;
+  pi_mutex_unlock (&m, self);
+}
+
+static void
+take_and_leave (void *aux UNUSED)
+{
+  pi_mutex_lock (&m, gettid ());
+}
+
+void
+test_main (void)
+{
+  pid_t self = gettid (), tid;
+
+  CHECK (self == getpid (), "main thread's id is the pid");
+  pi_mutex_lock (&m, self);
+  CHECK (m.owner == self, "owner is in the word");
+  CHECK (futex (&m.owner, FUTEX_LOCK_PI, 0) == -1,
+         "locking it again fails");
+
+  CHECK ((tid = thread_spawn (waiter, NULL)) != PID_ERROR, "spawn waiter");
+  while (!(__atomic_load_n (&m.owner, __ATOMIC_ACQUIRE) & FUTEX_WAITERS))
+    continue;
+  CHECK (!got_it, "waiter is waiting");
+  CHECK (waiter_tid == tid, "waiter's id is the spawned id");
+  pi_mutex_unlock (&m, self);
+  CHECK (thread_join (tid) == 0, "join waiter");
+  CHECK (got_it, "waiter got the mutex");
+  CHECK (m.owner == 0, "mutex is free");
+  CHECK (futex (&m.owner, FUTEX_UNLOCK_PI, 0) == -1,
+         "unlocking a free mutex fails");
+
+  CHECK ((tid = thread_spawn (take_and_leave, NULL)) != PID_ERROR,
+         "spawn a thread that exits holding the mutex");
+  CHECK (thread_join (tid) == 0, "join it");
+  CHECK (m.owner == tid, "its id is still in the word");
+  pi_mutex_lock (&m, self);
+  CHECK (m.owner == self, "took it over");
+  pi_mutex_unlock (&m, self);
+}
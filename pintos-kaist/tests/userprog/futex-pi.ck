@@ -0,0 +1,23 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+check_expected (IGNORE_EXIT_CODES => 1, [<<'EOF']);
+(futex-pi) begin
+(futex-pi) main thread's id is the pid
+(futex-pi) owner is in the word
+(futex-pi) locking it again fails
+(futex-pi) spawn waiter
+(futex-pi) waiter is waiting
+(futex-pi) waiter's id is the spawned id
+(futex-pi) join waiter
+(futex-pi) waiter got the mutex
+(futex-pi) mutex is free
+(futex-pi) unlocking a free mutex fails
+(futex-pi) spawn a thread that exits holding the mutex
+(futex-pi) join it
+(futex-pi) its id is still in the word
+(futex-pi) took it over
+(futex-pi) end
+EOF
+pass;
@@ -1,11 +1,11 @@
-/* Tests the halt system call. */
-
-#include "tests/lib.h"
-#include "tests/main.h"
-
-void
-test_main (void) 
-{
-  halt ();
-  fail ("should have halted");
-}
+/* Tests the halt system call. */
+
+#include "tests/lib.h"
+#include "tests/main.h"
+
+void
+test_main (void) 
+{
+  halt ();
+  fail ("should have halted");
+}
@@ -0,0 +1,51 @@
+/* Measures malloc() and free() throughput.  Each round allocates
+   blocks of mixed sizes, mostly small but every sixteenth one large
+   enough to take a run of pages, fills them, and frees them in a
+   scrambled order after checking their contents. */
+
+#include <malloc.h>
+#include <random.h>
+#include <string.h>
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+#define BLOCKS 512
+#define ROUNDS 32
+
+static uint8_t *blocks[BLOCKS];
+static size_t sizes[BLOCKS];
+
+void
+test_main (void)
+{
+  struct timespec start, end;
+  int round, i;
+
+  random_init (0);
+  clock_gettime (&start);
+  for (round = 0; round < ROUNDS; round++)
+    {
+      for (i = 0; i < BLOCKS; i++)
+        {
+          sizes[i] = 1 + random_ulong () % (i % 16 == 0 ? 20000 : 512);
+          blocks[i] = malloc (sizes[i]);
+          if (blocks[i] == NULL)
+            fail ("malloc of %zu bytes failed in round %d", sizes[i], round);
+          memset (blocks[i], i, sizes[i]);
+        }
+      for (i = 0; i < BLOCKS; i++)
+        {
+          /* 7919 is prime, so this visits every block once. */
+          int j = (i * 7919) % BLOCKS;
+          if (blocks[j][0] != (uint8_t) j
+              || blocks[j][sizes[j] - 1] != (uint8_t) j)
+            fail ("block %d was overwritten in round %d", j, round);
+          free (blocks[j]);
+        }
+    }
+  clock_gettime (&end);
+  msg ("%d allocations in %lld us", ROUNDS * BLOCKS,
+       (end.tv_sec - start.tv_sec) * 1000000LL
+       + (end.tv_nsec - start.tv_nsec) / 1000);
+}
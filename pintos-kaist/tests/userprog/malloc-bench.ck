@@ -0,0 +1,17 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+our ($test);
+my (@output) = read_text_file ("$test.output");
+common_checks ("run", @output);
+
+# Timings vary from run to run.
+my ($timing) = qr/^\(malloc-bench\) 16384 allocations in \d+ us$/;
+fail "No timing reported.\n" if !grep (/$timing/, @output);
+@output = grep (!/$timing/, @output);
+compare_output ("run", IGNORE_EXIT_CODES => 1, \@output, [<<'EOF']);
+(malloc-bench) begin
+(malloc-bench) end
+EOF
+pass;
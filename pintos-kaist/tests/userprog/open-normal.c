@@ -1,13 +1,13 @@
-/* Open a file. */
-
-#include <syscall.h>
-#include "tests/lib.h"
-#include "tests/main.h"
-
-void
-test_main (void) 
-{
-  int handle = open ("sample.txt");
-  if (handle < 2)
-    fail ("open() returned %d", handle);
-}
+/* Open a file. */
+
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+void
+test_main (void) 
+{
+  int handle = open ("sample.txt");
+  if (handle < 2)
+    fail ("open() returned %d", handle);
+}
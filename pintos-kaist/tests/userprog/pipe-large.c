@@ -0,0 +1,77 @@
+/* Measures pipe throughput with large, page-aligned writes, which move
+   pages instead of copying them.  The parent stamps each page before
+   writing it and restamps it right after, so the child, which checks
+   the stamps, also catches a write that leaks into data already in
+   the pipe. */
+
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+#define PAGE 4096
+#define PAGES 16
+#define ROUNDS 64
+
+static int wbuf[PAGES][PAGE / sizeof (int)] __attribute__ ((aligned (PAGE)));
+static int rbuf[PAGES][PAGE / sizeof (int)] __attribute__ ((aligned (PAGE)));
+
+static void
+consume (int fd)
+{
+  int round, got, n, p;
+
+  for (round = 0; round < ROUNDS; round++)
+    {
+      for (got = 0; got < (int) sizeof rbuf; got += n)
+        {
+          n = read (fd, (char *) rbuf + got, sizeof rbuf - got);
+          if (n <= 0)
+            fail ("read returned %d in round %d", n, round);
+        }
+      for (p = 0; p < PAGES; p++)
+        if (rbuf[p][0] != round * PAGES + p
+            || rbuf[p][PAGE / sizeof (int) - 1] != p)
+          fail ("page %d of round %d is wrong", p, round);
+    }
+  if (read (fd, rbuf, sizeof rbuf) != 0)
+    fail ("no end of file after %d rounds", ROUNDS);
+  exit (0);
+}
+
+void
+test_main (void)
+{
+  struct timespec start, end;
+  int fds[2], round, p;
+  pid_t pid;
+
+  CHECK (pipe (fds) == 0, "pipe");
+  pid = fork ("consumer");
+  if (pid == 0)
+    {
+      close (fds[1]);
+      consume (fds[0]);
+    }
+  close (fds[0]);
+
+  clock_gettime (&start);
+  for (round = 0; round < ROUNDS; round++)
+    {
+      for (p = 0; p < PAGES; p++)
+        {
+          wbuf[p][0] = round * PAGES + p;
+          wbuf[p][PAGE / sizeof (int) - 1] = p;
+        }
+      if (write (fds[1], wbuf, sizeof wbuf) != sizeof wbuf)
+        fail ("write in round %d failed", round);
+      for (p = 0; p < PAGES; p++)
+        wbuf[p][0] = -1;
+    }
+  close (fds[1]);
+  CHECK (wait (pid) == 0, "consumer read everything");
+  clock_gettime (&end);
+
+  msg ("throughput: %d kB in %lld us", PAGES * PAGE / 1024 * ROUNDS,
+       ((end.tv_sec - start.tv_sec) * 1000000000LL
+        + end.tv_nsec - start.tv_nsec) / 1000);
+}
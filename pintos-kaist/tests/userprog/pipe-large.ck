@@ -0,0 +1,19 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+our ($test);
+my (@output) = read_text_file ("$test.output");
+common_checks ("run", @output);
+
+# Timings vary from run to run.
+my ($timing) = qr/^\(pipe-large\) throughput: \d+ kB in \d+ us$/;
+fail "No throughput reported.\n" if !grep (/$timing/, @output);
+@output = grep (!/$timing/, @output);
+compare_output ("run", IGNORE_EXIT_CODES => 1, \@output, [<<'EOF']);
+(pipe-large) begin
+(pipe-large) pipe
+(pipe-large) consumer read everything
+(pipe-large) end
+EOF
+pass;
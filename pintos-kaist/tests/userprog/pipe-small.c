@@ -0,0 +1,68 @@
+/* Measures pipe throughput with small writes: a child reads what the
+   parent writes 64 bytes at a time, checking every byte, and the
+   parent reports how long the whole transfer took. */
+
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+#define CHUNK 64
+#define TOTAL (256 * 1024)
+
+static char
+pattern (int ofs)
+{
+  return ofs * 7 + ofs / 251;
+}
+
+static void
+consume (int fd)
+{
+  char buf[CHUNK * 3];
+  int total = 0, n, i;
+
+  while ((n = read (fd, buf, sizeof buf)) > 0)
+    {
+      for (i = 0; i < n; i++)
+        if (buf[i] != pattern (total + i))
+          fail ("byte %d is wrong", total + i);
+      total += n;
+    }
+  if (total != TOTAL)
+    fail ("read %d bytes instead of %d", total, TOTAL);
+  exit (0);
+}
+
+void
+test_main (void)
+{
+  struct timespec start, end;
+  char buf[CHUNK];
+  int fds[2], ofs, i;
+  pid_t pid;
+
+  CHECK (pipe (fds) == 0, "pipe");
+  pid = fork ("consumer");
+  if (pid == 0)
+    {
+      close (fds[1]);
+      consume (fds[0]);
+    }
+  close (fds[0]);
+
+  clock_gettime (&start);
+  for (ofs = 0; ofs < TOTAL; ofs += CHUNK)
+    {
+      for (i = 0; i < CHUNK; i++)
+        buf[i] = pattern (ofs + i);
+      if (write (fds[1], buf, CHUNK) != CHUNK)
+        fail ("write at %d failed", ofs);
+    }
+  close (fds[1]);
+  CHECK (wait (pid) == 0, "consumer read everything");
+  clock_gettime (&end);
+
+  msg ("throughput: %d kB in %lld us", TOTAL / 1024,
+       ((end.tv_sec - start.tv_sec) * 1000000000LL
+        + end.tv_nsec - start.tv_nsec) / 1000);
+}
@@ -0,0 +1,19 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+our ($test);
+my (@output) = read_text_file ("$test.output");
+common_checks ("run", @output);
+
+# Timings vary from run to run.
+my ($timing) = qr/^\(pipe-small\) throughput: \d+ kB in \d+ us$/;
+fail "No throughput reported.\n" if !grep (/$timing/, @output);
+@output = grep (!/$timing/, @output);
+compare_output ("run", IGNORE_EXIT_CODES => 1, \@output, [<<'EOF']);
+(pipe-small) begin
+(pipe-small) pipe
+(pipe-small) consumer read everything
+(pipe-small) end
+EOF
+pass;
@@ -0,0 +1,64 @@
+/* Drives a pipe through poll() and non-blocking reads and writes:
+   timeouts with nothing to read, a child's write waking a poll()
+   that waits forever, a non-blocking writer filling the pipe, and
+   hang-up once the writer is gone. */
+
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+static char big[128 * 1024];
+
+void
+test_main (void)
+{
+  struct pollfd pfd[2];
+  char c;
+  int fds[2], n;
+  pid_t pid;
+
+  CHECK (pipe (fds) == 0, "pipe");
+  CHECK (fcntl (fds[0], F_SETFL, O_NONBLOCK) == 0, "make read end non-blocking");
+  CHECK (fcntl (fds[0], F_GETFL, 0) == O_NONBLOCK, "flag reads back");
+  CHECK (read (fds[0], &c, 1) == -1, "empty non-blocking read fails");
+
+  pfd[0].fd = fds[0];
+  pfd[0].events = POLLIN;
+  pfd[1].fd = 1234;
+  pfd[1].events = POLLIN;
+  CHECK (poll (pfd, 1, 0) == 0 && pfd[0].revents == 0,
+         "poll with no wait finds nothing");
+  CHECK (poll (pfd, 1, 50) == 0, "poll times out");
+  CHECK (poll (pfd, 2, 0) == 1 && pfd[1].revents == POLLNVAL,
+         "bad descriptor is reported");
+
+  pid = fork ("writer");
+  if (pid == 0)
+    {
+      close (fds[0]);
+      write (fds[1], "x", 1);
+      exit (0);
+    }
+  CHECK (poll (pfd, 1, -1) == 1 && (pfd[0].revents & POLLIN),
+         "child's write wakes poll");
+  CHECK (read (fds[0], &c, 1) == 1 && c == 'x', "read what the child wrote");
+  CHECK (wait (pid) == 0, "wait for child");
+
+  CHECK (fcntl (fds[1], F_SETFL, O_NONBLOCK) == 0, "make write end non-blocking");
+  n = write (fds[1], big, sizeof big);
+  CHECK (n > 0 && n < (int) sizeof big, "non-blocking write fills the pipe");
+  CHECK (write (fds[1], big, 1) == -1, "write to a full pipe fails");
+  pfd[0].fd = fds[1];
+  pfd[0].events = POLLOUT;
+  CHECK (poll (pfd, 1, 0) == 0, "full pipe is not writable");
+  CHECK (read (fds[0], big, sizeof big) == n, "drain the pipe");
+  CHECK (poll (pfd, 1, 0) == 1 && pfd[0].revents == POLLOUT,
+         "drained pipe is writable");
+
+  close (fds[1]);
+  pfd[0].fd = fds[0];
+  pfd[0].events = POLLIN;
+  CHECK (poll (pfd, 1, -1) == 1 && pfd[0].revents == POLLHUP,
+         "closed writer hangs up");
+  CHECK (read (fds[0], &c, 1) == 0, "read at end of file");
+}
@@ -0,0 +1,27 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+check_expected (IGNORE_EXIT_CODES => 1, [<<'EOF']);
+(poll-pipe) begin
+(poll-pipe) pipe
+(poll-pipe) make read end non-blocking
+(poll-pipe) flag reads back
+(poll-pipe) empty non-blocking read fails
+(poll-pipe) poll with no wait finds nothing
+(poll-pipe) poll times out
+(poll-pipe) bad descriptor is reported
+(poll-pipe) child's write wakes poll
+(poll-pipe) read what the child wrote
+(poll-pipe) wait for child
+(poll-pipe) make write end non-blocking
+(poll-pipe) non-blocking write fills the pipe
+(poll-pipe) write to a full pipe fails
+(poll-pipe) full pipe is not writable
+(poll-pipe) drain the pipe
+(poll-pipe) drained pipe is writable
+(poll-pipe) closed writer hangs up
+(poll-pipe) read at end of file
+(poll-pipe) end
+EOF
+pass;
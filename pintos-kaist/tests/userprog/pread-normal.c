@@ -0,0 +1,38 @@
+/* Reads and writes a file with pread() and pwrite(), and checks that
+   neither moves the file position. */
+
+#include <string.h>
+#include <syscall.h>
+#include "tests/userprog/sample.inc"
+#include "tests/lib.h"
+#include "tests/main.h"
+
+void
+test_main (void) 
+{
+  char buf[16];
+  int handle, byte_cnt;
+
+  CHECK ((handle = open ("sample.txt")) > 1, "open \"sample.txt\"");
+
+  byte_cnt = pread (handle, buf, sizeof buf, 10);
+  if (byte_cnt != sizeof buf)
+    fail ("pread() returned %d instead of %zu", byte_cnt, sizeof buf);
+  if (memcmp (buf, sample + 10, sizeof buf))
+    fail ("pread() at offset 10 returned wrong data");
+  if (tell (handle) != 0)
+    fail ("pread() moved file position to %u", tell (handle));
+
+  byte_cnt = pwrite (handle, "XYZ", 3, 20);
+  if (byte_cnt != 3)
+    fail ("pwrite() returned %d instead of 3", byte_cnt);
+  if (tell (handle) != 0)
+    fail ("pwrite() moved file position to %u", tell (handle));
+
+  CHECK (pread (handle, buf, 3, 20) == 3, "pread back what pwrite wrote");
+  if (memcmp (buf, "XYZ", 3))
+    fail ("pread() did not return what pwrite() wrote");
+
+  CHECK (pread (handle, buf, sizeof buf, sizeof sample - 1) == 0,
+         "pread at end of file");
+}
@@ -0,0 +1,73 @@
+/* Queues several file operations on a shared ring, runs them with a
+   single ring_enter(), and reaps their completions as a batch.  Also
+   checks that a failed request cancels the requests linked to it. */
+
+#include <ring.h>
+#include <string.h>
+#include <syscall.h>
+#include <syscall-nr.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+#define RING_ADDR ((struct ring *) 0x20000000)
+
+static void
+queue (struct ring *r, uint32_t opcode, uint32_t flags, uint64_t a0,
+       uint64_t a1, uint64_t a2, uint64_t a3, uint64_t user_data)
+{
+  struct ring_sqe *sqe = ring_get_sqe (r);
+  if (sqe == NULL)
+    fail ("submission queue full");
+  sqe->opcode = opcode;
+  sqe->flags = flags;
+  sqe->args[0] = a0;
+  sqe->args[1] = a1;
+  sqe->args[2] = a2;
+  sqe->args[3] = a3;
+  sqe->user_data = user_data;
+  ring_sq_commit (r);
+}
+
+void
+test_main (void) 
+{
+  static const char data[] = "ring buffer";
+  struct ring *r = RING_ADDR;
+  char buf[sizeof data];
+  int handle;
+  uint32_t i;
+
+  CHECK (ring_setup (r, 8) == 0, "ring_setup");
+  CHECK (create ("test.txt", 0), "create \"test.txt\"");
+  CHECK ((handle = open ("test.txt")) > 1, "open \"test.txt\"");
+
+  queue (r, SYS_WRITE, RING_F_LINK, handle, (uint64_t) data, 5, 0, 1);
+  queue (r, SYS_WRITE, RING_F_LINK, handle, (uint64_t) data + 5,
+         sizeof data - 5, 0, 2);
+  queue (r, SYS_PREAD, 0, handle, (uint64_t) buf, sizeof buf, 0, 3);
+  CHECK (ring_enter (3) == 3, "ring_enter three requests");
+
+  if (ring_cq_ready (r) != 3)
+    fail ("%u completions ready instead of 3", ring_cq_ready (r));
+  for (i = 0; i < 3; i++)
+    {
+      struct ring_cqe *cqe = ring_cqe_at (r, i);
+      int64_t want = cqe->user_data == 1 ? 5 : (int64_t) sizeof data - 5;
+      if (cqe->user_data == 3)
+        want = sizeof data;
+      if (cqe->user_data != i + 1 || cqe->res != want)
+        fail ("completion %u: user_data %d, res %d",
+              i, (int) cqe->user_data, (int) cqe->res);
+    }
+  ring_cq_advance (r, 3);
+  if (memcmp (buf, data, sizeof data))
+    fail ("read back wrong data");
+
+  queue (r, SYS_READ, RING_F_LINK, 1234, (uint64_t) buf, 1, 0, 4);
+  queue (r, SYS_WRITE, 0, handle, (uint64_t) data, 1, 0, 5);
+  CHECK (ring_enter (2) == 2, "ring_enter failing chain");
+  if (ring_cqe_at (r, 0)->res != -1 || ring_cqe_at (r, 1)->res != RING_CANCELED)
+    fail ("chain not canceled: results %d, %d",
+          (int) ring_cqe_at (r, 0)->res, (int) ring_cqe_at (r, 1)->res);
+  ring_cq_advance (r, 2);
+}
@@ -0,0 +1,15 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+check_expected ([<<'EOF']);
+(ring-normal) begin
+(ring-normal) ring_setup
+(ring-normal) create "test.txt"
+(ring-normal) open "test.txt"
+(ring-normal) ring_enter three requests
+(ring-normal) ring_enter failing chain
+(ring-normal) end
+ring-normal: exit(0)
+EOF
+pass;
@@ -0,0 +1,41 @@
+/* Grows the heap with sbrk(), checks that new pages read as zero and
+   keep what is written to them, shrinks the heap and grows it again,
+   and checks that brk() does not go below the start of the heap. */
+
+#include <string.h>
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+#define PAGE 4096
+
+void
+test_main (void)
+{
+  uint8_t *base;
+  int i;
+
+  CHECK ((base = sbrk (0)) != (void *) -1, "sbrk (0)");
+  CHECK (sbrk (3 * PAGE) == base, "grow heap by 3 pages");
+  for (i = 0; i < 3 * PAGE; i++)
+    if (base[i] != 0)
+      fail ("byte %d of the new heap is not zero", i);
+  memset (base, 0x5a, 3 * PAGE);
+  for (i = 0; i < 3 * PAGE; i++)
+    if (base[i] != 0x5a)
+      fail ("byte %d of the heap lost its value", i);
+  msg ("new heap is zeroed and writable");
+
+  CHECK (sbrk (-2 * PAGE) == base + 3 * PAGE, "shrink heap by 2 pages");
+  CHECK (sbrk (2 * PAGE) == base + PAGE, "grow it back");
+  if (base[0] != 0x5a)
+    fail ("page that stayed in the heap lost its contents");
+  for (i = PAGE; i < 3 * PAGE; i++)
+    if (base[i] != 0)
+      fail ("byte %d was not zeroed after shrinking", i);
+  msg ("regrown pages are zeroed");
+
+  CHECK (brk (base - PAGE) == -1, "brk below the heap fails");
+  CHECK (brk (base) == 0, "brk to the start of the heap");
+  CHECK (sbrk (0) == base, "heap is empty");
+}
@@ -0,0 +1,18 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+check_expected (IGNORE_EXIT_CODES => 1, [<<'EOF']);
+(sbrk-normal) begin
+(sbrk-normal) sbrk (0)
+(sbrk-normal) grow heap by 3 pages
+(sbrk-normal) new heap is zeroed and writable
+(sbrk-normal) shrink heap by 2 pages
+(sbrk-normal) grow it back
+(sbrk-normal) regrown pages are zeroed
+(sbrk-normal) brk below the heap fails
+(sbrk-normal) brk to the start of the heap
+(sbrk-normal) heap is empty
+(sbrk-normal) end
+EOF
+pass;
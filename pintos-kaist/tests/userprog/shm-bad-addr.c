@@ -0,0 +1,27 @@
+/* Tries to map a shared memory object over kernel addresses, at the
+   top of the address space, where the end of the range wraps around,
+   and just below the kernel, where it runs into it.  Each must fail
+   without mapping anything. */
+
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+#define PAGE 4096
+#define PAGES 2
+#define KERN_BASE 0x8004000000ULL
+
+void
+test_main (void)
+{
+  int fd;
+
+  CHECK ((fd = shm_open (PAGES * PAGE)) > 1, "shm_open");
+  CHECK (shm_map (fd, (void *) KERN_BASE, true) == NULL,
+         "shm_map at kernel base");
+  CHECK (shm_map (fd, (void *) 0xfffffffffffff000ULL, true) == NULL,
+         "shm_map wrapping around");
+  CHECK (shm_map (fd, (void *) (KERN_BASE - PAGE), true) == NULL,
+         "shm_map into kernel");
+  close (fd);
+}
@@ -0,0 +1,13 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+check_expected (IGNORE_EXIT_CODES => 1, [<<'EOF']);
+(shm-bad-addr) begin
+(shm-bad-addr) shm_open
+(shm-bad-addr) shm_map at kernel base
+(shm-bad-addr) shm_map wrapping around
+(shm-bad-addr) shm_map into kernel
+(shm-bad-addr) end
+EOF
+pass;
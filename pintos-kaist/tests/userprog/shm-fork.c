@@ -0,0 +1,48 @@
+/* Shares memory with a child through shm_open() and shm_map(): the
+   child writes through the mapping it inherits from fork() and
+   through a second mapping of the inherited descriptor, and the
+   parent sees both. */
+
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+#define PAGE 4096
+#define PAGES 3
+
+void
+test_main (void)
+{
+  int *shared = (int *) 0x10000000;
+  int *alias = (int *) 0x20000000;
+  int fd, i;
+  pid_t pid;
+
+  CHECK ((fd = shm_open (PAGES * PAGE)) > 1, "shm_open");
+  CHECK (shm_map (fd, shared, true) == shared, "shm_map");
+  for (i = 0; i < PAGES; i++)
+    if (shared[i * PAGE / sizeof (int)] != 0)
+      fail ("page %d is not zeroed", i);
+
+  pid = fork ("child");
+  if (pid == 0)
+    {
+      for (i = 0; i < PAGES; i++)
+        shared[i * PAGE / sizeof (int)] = i + 1;
+      if (shm_map (fd, alias, true) != alias)
+        fail ("child could not map inherited descriptor");
+      alias[1] = 42;
+      exit (0);
+    }
+  CHECK (wait (pid) == 0, "wait for child");
+
+  for (i = 0; i < PAGES; i++)
+    if (shared[i * PAGE / sizeof (int)] != i + 1)
+      fail ("child's store to page %d not visible", i);
+  if (shared[1] != 42)
+    fail ("child's store through its alias not visible");
+  msg ("child's stores visible");
+
+  CHECK (shm_unmap (shared, PAGES * PAGE) == 0, "shm_unmap");
+  close (fd);
+}
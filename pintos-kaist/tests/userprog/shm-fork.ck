@@ -0,0 +1,14 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+check_expected (IGNORE_EXIT_CODES => 1, [<<'EOF']);
+(shm-fork) begin
+(shm-fork) shm_open
+(shm-fork) shm_map
+(shm-fork) wait for child
+(shm-fork) child's stores visible
+(shm-fork) shm_unmap
+(shm-fork) end
+EOF
+pass;
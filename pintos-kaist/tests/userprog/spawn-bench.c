@@ -0,0 +1,69 @@
+/* Starts child-simple ITERATIONS times each with fork() and exec(),
+   with vfork() and exec(), and with spawn(), waiting for each child,
+   and reports how long each way takes. */
+
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+#define ITERATIONS 16
+
+static pid_t
+start_fork (void)
+{
+  pid_t pid = fork ("child-simple");
+  if (pid == 0)
+    {
+      exec ("child-simple");
+      exit (-1);
+    }
+  return pid;
+}
+
+static pid_t
+start_vfork (void)
+{
+  pid_t pid = vfork ();
+  if (pid == 0)
+    {
+      exec ("child-simple");
+      exit (-1);
+    }
+  return pid;
+}
+
+static pid_t
+start_spawn (void)
+{
+  return spawn ("child-simple", NULL, 0);
+}
+
+/* Runs START ITERATIONS times and reports the time taken as NAME. */
+static void
+bench (const char *name, pid_t (*start) (void))
+{
+  struct timespec t0, t1;
+  int i;
+
+  clock_gettime (&t0);
+  for (i = 0; i < ITERATIONS; i++)
+    {
+      pid_t pid = start ();
+      if (pid == PID_ERROR)
+        fail ("%s: start %d failed", name, i);
+      if (wait (pid) != 81)
+        fail ("%s: child %d did not run", name, i);
+    }
+  clock_gettime (&t1);
+  msg ("%s: %d children in %lld us", name, ITERATIONS,
+       (t1.tv_sec - t0.tv_sec) * 1000000LL
+       + (t1.tv_nsec - t0.tv_nsec) / 1000);
+}
+
+void
+test_main (void)
+{
+  bench ("fork+exec", start_fork);
+  bench ("vfork+exec", start_vfork);
+  bench ("spawn", start_spawn);
+}
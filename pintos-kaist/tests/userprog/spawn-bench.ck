@@ -0,0 +1,24 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+our ($test);
+my (@output) = read_text_file ("$test.output");
+common_checks ("run", @output);
+
+# Every child prints a line of its own, and timings vary from run to
+# run.
+my ($children) = grep (/^\(child-simple\) run$/, @output);
+fail "Expected 48 children to run, but $children did.\n"
+  if $children != 48;
+@output = grep (!/^\(child-simple\) run$/, @output);
+foreach my $way ('fork\+exec', 'vfork\+exec', 'spawn') {
+    my ($timing) = qr/^\(spawn-bench\) $way: 16 children in \d+ us$/;
+    fail "No timing reported for $way.\n" if !grep (/$timing/, @output);
+    @output = grep (!/$timing/, @output);
+}
+compare_output ("run", IGNORE_EXIT_CODES => 1, \@output, [<<'EOF']);
+(spawn-bench) begin
+(spawn-bench) end
+EOF
+pass;
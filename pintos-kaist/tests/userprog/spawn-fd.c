@@ -0,0 +1,40 @@
+/* Starts child-simple with spawn(), pointing its standard output at a
+   pipe, and reads back what it prints.  Also checks that spawning a
+   missing program fails in the parent. */
+
+#include <stdio.h>
+#include <string.h>
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+void
+test_main (void)
+{
+  static const char expected[] = "(child-simple) run\n";
+  char buf[64];
+  struct spawn_action actions[2];
+  int fds[2], got, n;
+  pid_t pid;
+
+  CHECK (pipe (fds) == 0, "pipe");
+  actions[0].op = SPAWN_DUP2;
+  actions[0].fd = fds[1];
+  actions[0].newfd = STDOUT_FILENO;
+  actions[1].op = SPAWN_CLOSE;
+  actions[1].fd = fds[0];
+  CHECK ((pid = spawn ("child-simple", actions, 2)) > 0,
+         "spawn child-simple");
+  close (fds[1]);
+
+  for (got = 0; (n = read (fds[0], buf + got, sizeof buf - got)) > 0;
+       got += n)
+    continue;
+  if (got != (int) strlen (expected) || memcmp (buf, expected, got))
+    fail ("child's output did not come through the pipe");
+  msg ("child's output came through the pipe");
+  CHECK (wait (pid) == 81, "wait for child-simple");
+
+  CHECK (spawn ("no-such-file", NULL, 0) == PID_ERROR,
+         "spawn no-such-file");
+}
@@ -0,0 +1,15 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+check_expected (IGNORE_EXIT_CODES => 1, [<<'EOF']);
+(spawn-fd) begin
+(spawn-fd) pipe
+(spawn-fd) spawn child-simple
+(spawn-fd) child's output came through the pipe
+(spawn-fd) wait for child-simple
+load: no-such-file: open failed
+(spawn-fd) spawn no-such-file
+(spawn-fd) end
+EOF
+pass;
@@ -0,0 +1,47 @@
+/* Makes a few system calls and checks that the per-process and
+   kernel-wide statistics account for them. */
+
+#include <syscall.h>
+#include <syscall-nr.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+static uint64_t
+hist_total (const struct syscall_stat *st)
+{
+  uint64_t total = 0;
+  int i;
+
+  for (i = 0; i < SYSCALL_HIST_BUCKETS; i++)
+    total += st->hist[i];
+  return total;
+}
+
+void
+test_main (void) 
+{
+  struct syscall_stat before, after, global;
+  int i;
+
+  CHECK (syscall_stats (SYS_TELL, false, &before) == 0,
+         "read own tell() statistics");
+  for (i = 0; i < 10; i++)
+    tell (0);
+  CHECK (syscall_stats (SYS_TELL, false, &after) == 0,
+         "read own tell() statistics again");
+  if (after.count != before.count + 10)
+    fail ("tell() count went from %d to %d",
+          (int) before.count, (int) after.count);
+  if (hist_total (&after) != after.count)
+    fail ("histogram holds %d calls, not %d",
+          (int) hist_total (&after), (int) after.count);
+
+  CHECK (syscall_stats (SYS_TELL, true, &global) == 0,
+         "read kernel-wide tell() statistics");
+  if (global.count < after.count)
+    fail ("kernel-wide count %d below own count %d",
+          (int) global.count, (int) after.count);
+
+  CHECK (syscall_stats (SYS_CALL_CNT, true, &global) == -1,
+         "out-of-range number rejected");
+}
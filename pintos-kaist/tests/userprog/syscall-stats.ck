@@ -0,0 +1,14 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+check_expected ([<<'EOF']);
+(syscall-stats) begin
+(syscall-stats) read own tell() statistics
+(syscall-stats) read own tell() statistics again
+(syscall-stats) read kernel-wide tell() statistics
+(syscall-stats) out-of-range number rejected
+(syscall-stats) end
+syscall-stats: exit(0)
+EOF
+pass;
@@ -0,0 +1,38 @@
+/* One thread calls exit() while another is blocked reading an empty
+   pipe and the main thread waits to join the reader.  exit() must
+   wake the reader and end all three, with the exiting thread's
+   status. */
+
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+static int fds[2];
+
+static void
+reader (void *aux UNUSED)
+{
+  char c;
+
+  read (fds[0], &c, 1);
+  fail ("read returned");
+}
+
+static void
+quit (void *aux UNUSED)
+{
+  exit (57);
+}
+
+void
+test_main (void)
+{
+  pid_t r;
+
+  CHECK (pipe (fds) == 0, "pipe");
+  CHECK ((r = thread_spawn (reader, NULL)) != PID_ERROR,
+         "spawn reading thread");
+  CHECK (thread_spawn (quit, NULL) != PID_ERROR, "spawn exiting thread");
+  thread_join (r);
+  fail ("should have exited");
+}
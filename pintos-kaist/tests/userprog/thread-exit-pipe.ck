@@ -0,0 +1,12 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+check_expected ([<<'EOF']);
+(thread-exit-pipe) begin
+(thread-exit-pipe) pipe
+(thread-exit-pipe) spawn reading thread
+(thread-exit-pipe) spawn exiting thread
+thread-exit-pipe: exit(57)
+EOF
+pass;
@@ -0,0 +1,32 @@
+/* One thread calls exit() while another spins in user mode and the
+   main thread waits to join the spinning one.  exit() must end all
+   three, with the status the exiting thread gave. */
+
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+static void
+spin (void *aux UNUSED)
+{
+  for (;;)
+    continue;
+}
+
+static void
+quit (void *aux UNUSED)
+{
+  exit (57);
+}
+
+void
+test_main (void)
+{
+  pid_t spinner;
+
+  CHECK ((spinner = thread_spawn (spin, NULL)) != PID_ERROR,
+         "spawn spinning thread");
+  CHECK (thread_spawn (quit, NULL) != PID_ERROR, "spawn exiting thread");
+  thread_join (spinner);
+  fail ("should have exited");
+}
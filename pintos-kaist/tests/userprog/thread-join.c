@@ -0,0 +1,80 @@
+/* Starts threads that each sum their own part of a shared array, on
+   their own stacks, while one more writes to a file that the main
+   thread opened.  Joins them all and checks what they did. */
+
+#include <string.h>
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+#define THREADS 8
+#define PER_THREAD 4096
+
+static int data[THREADS * PER_THREAD];
+static long long sums[THREADS];
+static int fd;
+
+static void
+sum_part (void *aux)
+{
+  int part = (int) (intptr_t) aux;
+  char scratch[16 * 1024];
+  long long sum = 0;
+  size_t i;
+
+  /* Touch a few pages of this thread's stack. */
+  memset (scratch, part, sizeof scratch);
+  for (i = 0; i < PER_THREAD; i++)
+    sum += data[part * PER_THREAD + i];
+  for (i = 0; i < sizeof scratch; i++)
+    if (scratch[i] != part)
+      sum = -1;
+  sums[part] = sum;
+}
+
+static void
+write_file (void *aux UNUSED)
+{
+  write (fd, "shared", 6);
+}
+
+void
+test_main (void)
+{
+  pid_t tids[THREADS], writer;
+  char buf[6];
+  int i;
+
+  for (i = 0; i < THREADS * PER_THREAD; i++)
+    data[i] = i;
+  CHECK (create ("shared", 0), "create \"shared\"");
+  CHECK ((fd = open ("shared")) > 1, "open \"shared\"");
+
+  for (i = 0; i < THREADS; i++)
+    if ((tids[i] = thread_spawn (sum_part, (void *) (intptr_t) i))
+        == PID_ERROR)
+      fail ("thread_spawn %d failed", i);
+  CHECK ((writer = thread_spawn (write_file, NULL)) != PID_ERROR,
+         "spawn writer");
+  msg ("spawned %d threads", THREADS);
+
+  for (i = 0; i < THREADS; i++)
+    if (thread_join (tids[i]) != 0)
+      fail ("thread_join %d failed", i);
+  CHECK (thread_join (writer) == 0, "join writer");
+  CHECK (thread_join (tids[0]) == -1, "second join of a thread fails");
+  CHECK (thread_join (getpid ()) == -1, "joining oneself fails");
+
+  for (i = 0; i < THREADS; i++)
+    {
+      long long first = (long long) i * PER_THREAD;
+      long long last = first + PER_THREAD - 1;
+      if (sums[i] != (first + last) * PER_THREAD / 2)
+        fail ("thread %d summed %lld", i, sums[i]);
+    }
+  msg ("sums are right");
+
+  seek (fd, 0);
+  CHECK (read (fd, buf, sizeof buf) == sizeof buf
+         && !memcmp (buf, "shared", sizeof buf), "read what the writer wrote");
+}
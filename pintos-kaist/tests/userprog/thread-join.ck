@@ -0,0 +1,18 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+check_expected (IGNORE_EXIT_CODES => 1, [<<'EOF']);
+(thread-join) begin
+(thread-join) create "shared"
+(thread-join) open "shared"
+(thread-join) spawn writer
+(thread-join) spawned 8 threads
+(thread-join) join writer
+(thread-join) second join of a thread fails
+(thread-join) joining oneself fails
+(thread-join) sums are right
+(thread-join) read what the writer wrote
+(thread-join) end
+EOF
+pass;
@@ -0,0 +1,42 @@
+/* Reads the clock and the pid from the vDSO pages, and checks that the
+   clock does not go backwards and that a child sees its own pid. */
+
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+static int64_t
+to_ns (const struct timespec *ts)
+{
+  return ts->tv_sec * 1000000000LL + ts->tv_nsec;
+}
+
+void
+test_main (void) 
+{
+  struct timespec start, prev, now;
+  int64_t ticks = clock_ticks ();
+  pid_t pid;
+  int i;
+
+  clock_gettime (&start);
+  prev = start;
+  while (clock_ticks () < ticks + 5)
+    {
+      clock_gettime (&now);
+      if (to_ns (&now) < to_ns (&prev))
+        fail ("clock went backwards");
+      prev = now;
+    }
+  CHECK (to_ns (&now) > to_ns (&start), "clock advances");
+
+  for (i = 0; i < 2; i++)
+    {
+      pid = fork ("child");
+      if (pid == 0)
+        exit (getpid ());
+      if (wait (pid) != pid)
+        fail ("child's getpid() did not match fork()");
+    }
+  msg ("child's pid matches");
+}
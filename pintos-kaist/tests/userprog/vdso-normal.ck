@@ -0,0 +1,11 @@
+# -*- perl -*-
+use strict;
+use warnings;
+use tests::tests;
+check_expected (IGNORE_EXIT_CODES => 1, [<<'EOF']);
+(vdso-normal) begin
+(vdso-normal) clock advances
+(vdso-normal) child's pid matches
+(vdso-normal) end
+EOF
+pass;
@@ -1,20 +1,20 @@
-/* Tries to write to an invalid fd,
-   which must either fail silently or terminate the process with
-   exit code -1. */
-
-#include <limits.h>
-#include <syscall.h>
-#include "tests/main.h"
-
-void
-test_main (void) 
-{
-  char buf = 123;
-  write (0x01012342, &buf, 1);
-  write (7, &buf, 1);
-  write (2546, &buf, 1);
-  write (-5, &buf, 1);
-  write (-8192, &buf, 1);
-  write (INT_MIN + 1, &buf, 1);
-  write (INT_MAX - 1, &buf, 1);
-}
+/* Tries to write to an invalid fd,
+   which must either fail silently or terminate the process with
+   exit code -1. */
+
+#include <limits.h>
+#include <syscall.h>
+#include "tests/main.h"
+
+void
+test_main (void) 
+{
+  char buf = 123;
+  write (0x01012342, &buf, 1);
+  write (7, &buf, 1);
+  write (2546, &buf, 1);
+  write (-5, &buf, 1);
+  write (-8192, &buf, 1);
+  write (INT_MIN + 1, &buf, 1);
+  write (INT_MAX - 1, &buf, 1);
+}
@@ -0,0 +1,36 @@
+/* Writes a header and a body to a file with one writev(), then reads
+   them back into differently split buffers with one readv(). */
+
+#include <string.h>
+#include <syscall.h>
+#include "tests/lib.h"
+#include "tests/main.h"
+
+static char header[] = "header:";
+static char body[] = "the quick brown fox";
+
+void
+test_main (void) 
+{
+  char a[5], b[sizeof header + sizeof body - 2 - sizeof a];
+  struct iovec out[2] = {{header, sizeof header - 1}, {body, sizeof body - 1}};
+  struct iovec in[2] = {{a, sizeof a}, {b, sizeof b}};
+  int handle, byte_cnt;
+
+  CHECK (create ("test.txt", 0), "create \"test.txt\"");
+  CHECK ((handle = open ("test.txt")) > 1, "open \"test.txt\"");
+
+  byte_cnt = writev (handle, out, 2);
+  if (byte_cnt != sizeof header + sizeof body - 2)
+    fail ("writev() returned %d instead of %zu",
+          byte_cnt, sizeof header + sizeof body - 2);
+
+  seek (handle, 0);
+  byte_cnt = readv (handle, in, 2);
+  if (byte_cnt != sizeof a + sizeof b)
+    fail ("readv() returned %d instead of %zu", byte_cnt, sizeof a + sizeof b);
+  if (memcmp (a, "heade", 5) || memcmp (b, "r:", 2)
+      || memcmp (b + 2, body, sizeof body - 1))
+    fail ("readv() returned wrong data");
+  msg ("verified contents of \"test.txt\"");
+}
@@ -1,8 +1,8 @@
-#include "tests/main.h"
-#include "tests/vm/parallel-merge.h"
-
-void
-test_main (void) 
-{
-  parallel_merge ("child-qsort-mm", 80);
-}
+#include "tests/main.h"
+#include "tests/vm/parallel-merge.h"
+
+void
+test_main (void) 
+{
+  parallel_merge ("child-qsort-mm", 80);
+}
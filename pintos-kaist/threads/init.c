@@ -1,363 +1,431 @@
-#include "threads/init.h"
-#include <console.h>
-#include <debug.h>
-#include <limits.h>
-#include <random.h>
-#include <stddef.h>
-#include <stdint.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include "devices/kbd.h"
-#include "devices/input.h"
-#include "devices/serial.h"
-#include "devices/timer.h"
-#include "devices/vga.h"
-#include "threads/interrupt.h"
-#include "threads/io.h"
-#include "threads/loader.h"
-#include "threads/malloc.h"
-#include "threads/mmu.h"
-#include "threads/palloc.h"
-#include "threads/pte.h"
-#include "threads/thread.h"
-#ifdef USERPROG
-#include "userprog/process.h"
-#include "userprog/exception.h"
-#include "userprog/gdt.h"
-#include "userprog/syscall.h"
-#include "userprog/tss.h"
-#endif
-#include "tests/threads/tests.h"
-#ifdef VM
-#include "vm/vm.h"
-#endif
-#ifdef FILESYS
-#include "devices/disk.h"
-#include "filesys/filesys.h"
-#include "filesys/fsutil.h"
-#endif
-
-/* Page-map-level-4 with kernel mappings only. */
-uint64_t *base_pml4;
-
-#ifdef FILESYS
-/* -f: Format the file system? */
-static bool format_filesys;
-#endif
-
-/* -q: Power off after kernel tasks complete? */
-bool power_off_when_done;
-
-bool thread_tests;
-
-static void bss_init (void);
-static void paging_init (uint64_t mem_end);
-
-static char **read_command_line (void);
-static char **parse_options (char **argv);
-static void run_actions (char **argv);
-static void usage (void);
-
-static void print_stats (void);
-
-
-int main (void) NO_RETURN;
-
-/* Pintos main program. */
-int
-main (void) {
-	uint64_t mem_end;
-	char **argv;
-
-	/* BSS 영역을 초기화하고 머신의 RAM 크기를 가져온다. */
-	bss_init ();
-
-	/* Break command line into arguments and parse options. */
-	argv = read_command_line ();
-	argv = parse_options (argv);
-
-	/* Initialize ourselves as a thread so we can use locks,
-	   then enable console locking. */
-	thread_init ();
-	console_init ();
-
-	/* Initialize memory system. */
-	mem_end = palloc_init ();
-	malloc_init ();
-	paging_init (mem_end);
-
-#ifdef USERPROG
-	tss_init ();
-	gdt_init ();
-#endif
-
-	/* Initialize interrupt handlers. */
-	intr_init ();
-	timer_init ();
-	kbd_init ();
-	input_init ();
-#ifdef USERPROG
-	exception_init ();
-	syscall_init ();
-#endif
-	/* 스레드 스케줄러를 시작하고 인터럽트를 활성화한다. */
-	thread_start ();
-	serial_init_queue ();
-	timer_calibrate ();
-
-#ifdef FILESYS
-	/* Initialize file system. */
-	disk_init ();
-	filesys_init (format_filesys);
-#endif
-
-#ifdef VM
-	vm_init ();
-#endif
-
-	printf ("Boot complete.\n");
-
-	/* Run actions specified on kernel command line. */
-	//커널 명령줄에 지정된 동작들을 실행한다.
-	run_actions (argv);
-
-	/* Finish up. */
-	if (power_off_when_done)
-		power_off ();
-	thread_exit ();
-}
-
-/* Clear BSS */
-static void
-bss_init (void) {
-	/* The "BSS" is a segment that should be initialized to zeros.
-	   It isn't actually stored on disk or zeroed by the kernel
-	   loader, so we have to zero it ourselves.
-
-	   The start and end of the BSS segment is recorded by the
-	   linker as _start_bss and _end_bss.  See kernel.lds. */
-	extern char _start_bss, _end_bss;
-	memset (&_start_bss, 0, &_end_bss - &_start_bss);
-}
-
-/* 커널 가상 매핑으로 페이지 테이블을 채운 후,
-CPU가 새 페이지 디렉터리를 사용하도록 설정합니다.
-생성한 pml4를 base_pml4에 지정합니다. */
-static void
-paging_init (uint64_t mem_end) {
-	uint64_t *pml4, *pte;
-	int perm;
-	pml4 = base_pml4 = palloc_get_page (PAL_ASSERT | PAL_ZERO);
-
-	extern char start, _end_kernel_text;
-	// Maps physical address [0 ~ mem_end] to
-	//   [LOADER_KERN_BASE ~ LOADER_KERN_BASE + mem_end].
-	for (uint64_t pa = 0; pa < mem_end; pa += PGSIZE) {
-		uint64_t va = (uint64_t) ptov(pa);
-
-		perm = PTE_P | PTE_W;
-		if ((uint64_t) &start <= va && va < (uint64_t) &_end_kernel_text)
-			perm &= ~PTE_W;
-
-		if ((pte = pml4e_walk (pml4, va, 1)) != NULL)
-			*pte = pa | perm;
-	}
-
-	// reload cr3
-	pml4_activate(0);
-}
-
-/* Breaks the kernel command line into words and returns them as
-   an argv-like array. */
-static char **
-read_command_line (void) {
-	static char *argv[LOADER_ARGS_LEN / 2 + 1];
-	char *p, *end;
-	int argc;
-	int i;
-
-	argc = *(uint32_t *) ptov (LOADER_ARG_CNT);
-	p = ptov (LOADER_ARGS);
-	end = p + LOADER_ARGS_LEN;
-	for (i = 0; i < argc; i++) {
-		if (p >= end)
-			PANIC ("command line arguments overflow");
-
-		argv[i] = p;
-		p += strnlen (p, end - p) + 1;
-	}
-	argv[argc] = NULL;
-
-	/* Print kernel command line. */
-	printf ("Kernel command line:");
-	for (i = 0; i < argc; i++)
-		if (strchr (argv[i], ' ') == NULL)
-			printf (" %s", argv[i]);
-		else
-			printf (" '%s'", argv[i]);
-	printf ("\n");
-
-	return argv;
-}
-
-/* Parses options in ARGV[]
-   첫 번째 비옵션 인수를 반환한다. */
-static char **
-parse_options (char **argv) {
-	for (; *argv != NULL && **argv == '-'; argv++) {
-		char *save_ptr;
-		char *name = strtok_r (*argv, "=", &save_ptr);
-		char *value = strtok_r (NULL, "", &save_ptr);
-
-		if (!strcmp (name, "-h"))
-			usage ();
-		else if (!strcmp (name, "-q"))
-			power_off_when_done = true;
-#ifdef FILESYS
-		else if (!strcmp (name, "-f"))
-			format_filesys = true;
-#endif
-		else if (!strcmp (name, "-rs"))
-			random_init (atoi (value));
-		else if (!strcmp (name, "-mlfqs"))
-			thread_mlfqs = true;
-#ifdef USERPROG
-		else if (!strcmp (name, "-ul"))
-			user_page_limit = atoi (value);
-		else if (!strcmp (name, "-threads-tests"))
-			thread_tests = true;
-#endif
-		else
-			PANIC ("unknown option `%s' (use -h for help)", name);
-	}
-
-	return argv;
-}
-
-/* ARGV[1]에 지정된 작업(task)을 실행한다. */
-static void
-run_task (char **argv) {
-	const char *task = argv[1];
-	printf ("Executing '%s':\n", task);
-	//여기 안으로 들어가는 건가? 유저 프로그램이라고 인식이 된다면 여기 안으로?
-#ifdef USERPROG
-	if (thread_tests){	//현재 thread_tests가 false 이면 들어가지 않는다.
-		run_test (task);
-	} else {
-		process_wait (process_create_initd (task));  //테스트 이름 뒤의 인자를 가지고 process_create_initd을 먼저 호출한다.
-	}
-#else
-	run_test (task);
-#endif
-	printf ("Execution of '%s' complete.\n", task);
-}
-
-/* NULL 포인터 센티넬(null pointer sentinel)이 나올 때까지 argv[]에 지정된 모든 동작을 실행한다.*/
-static void
-run_actions (char **argv) {
-	/* An action. */
-	struct action {
-		char *name;                       /* 커널 명령줄에 지정된 실행 명령어 */
-		int argc;                         /* # action_name을 포함한 인자의 개수 */
-		void (*function) (char **argv);   /* 명령줄에 지정된 action name을 처리하는 함수 */
-	};
-
-	/* Table of supported actions. */
-	static const struct action actions[] = {
-		{"run", 2, run_task},
-#ifdef FILESYS
-		{"ls", 1, fsutil_ls},
-		{"cat", 2, fsutil_cat},
-		{"rm", 2, fsutil_rm},
-		{"put", 2, fsutil_put},
-		{"get", 2, fsutil_get},
-#endif
-		{NULL, 0, NULL},
-	};
-
-	while (*argv != NULL) {
-		const struct action *a;	
-		int i;
-
-		/* Find action name. */
-		for (a = actions; ; a++)			//a = 현재 actions가 된다.
-			if (a->name == NULL)			
-				PANIC ("unknown action `%s' (use -h for help)", *argv);
-			else if (!strcmp (*argv, a->name))
-				break;
-
-		/* Check for required arguments. */
-		for (i = 1; i < a->argc; i++)
-			if (argv[i] == NULL)
-				PANIC ("action `%s' requires %d argument(s)", *argv, a->argc - 1);
-
-		/* Invoke action and advance. */
-		a->function (argv);
-		argv += a->argc;
-	}
-
-}
-
-/* 커널 명령줄 도움말 메시지를 출력하고 머신의 전원을 끈다. */
-static void
-usage (void) {
-	printf ("\nCommand line syntax: [OPTION...] [ACTION...]\n"
-			"Options must precede actions.\n"
-			"Actions are executed in the order specified.\n"
-			"\nAvailable actions:\n"
-#ifdef USERPROG
-			"  run 'PROG [ARG...]' Run PROG and wait for it to complete.\n"
-#else
-			"  run TEST           Run TEST.\n"
-#endif
-#ifdef FILESYS
-			"  ls                 List files in the root directory.\n"
-			"  cat FILE           Print FILE to the console.\n"
-			"  rm FILE            Delete FILE.\n"
-			"Use these actions indirectly via `pintos' -g and -p options:\n"
-			"  put FILE           Put FILE into file system from scratch disk.\n"
-			"  get FILE           Get FILE from file system into scratch disk.\n"
-#endif
-			"\nOptions:\n"
-			"  -h                 Print this help message and power off.\n"
-			"  -q                 Power off VM after actions or on panic.\n"
-			"  -f                 Format file system disk during startup.\n"
-			"  -rs=SEED           Set random number seed to SEED.\n"
-			"  -mlfqs             Use multi-level feedback queue scheduler.\n"
-#ifdef USERPROG
-			"  -ul=COUNT          Limit user memory to COUNT pages.\n"
-#endif
-			);
-	power_off ();
-}
-
-
-/* Bochs나 QEMU에서 실행 중인 경우, 현재 실행 중인 머신의 전원을 종료한다. */
-void
-power_off (void) {
-#ifdef FILESYS
-	filesys_done ();
-#endif
-
-	print_stats ();
-
-	printf ("Powering off...\n");
-	outw (0x604, 0x2000);               /* Poweroff command for qemu */
-	for (;;);
-}
-
-/* Print statistics about Pintos execution. */
-static void
-print_stats (void) {
-	timer_print_stats ();
-	thread_print_stats ();
-#ifdef FILESYS
-	disk_print_stats ();
-#endif
-	console_print_stats ();
-	kbd_print_stats ();
-#ifdef USERPROG
-	exception_print_stats ();
-#endif
+#include "threads/init.h"
+#include <console.h>
+#include <debug.h>
+#include <klog.h>
+#include <limits.h>
+#include <random.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "devices/kbd.h"
+#include "devices/input.h"
+#include "devices/serial.h"
+#include "devices/timer.h"
+#include "devices/vga.h"
+#include "intrinsic.h"
+#include "threads/interrupt.h"
+#include "threads/io.h"
+#include "threads/loader.h"
+#include "threads/malloc.h"
+#include "threads/mmu.h"
+#include "threads/palloc.h"
+#include "threads/pte.h"
+#include "threads/thread.h"
+#ifdef USERPROG
+#include "userprog/process.h"
+#include "userprog/exception.h"
+#include "userprog/exec_cache.h"
+#include "userprog/gdt.h"
+#include "userprog/syscall.h"
+#include "userprog/tss.h"
+#include "userprog/uaccess.h"
+#include "userprog/vdso.h"
+#endif
+#include "tests/threads/tests.h"
+#ifdef VM
+#include "vm/vm.h"
+#endif
+#ifdef FILESYS
+#include "devices/disk.h"
+#include "filesys/filesys.h"
+#include "filesys/fsutil.h"
+#endif
+
+/* Page-map-level-4 with kernel mappings only. */
+uint64_t *base_pml4;
+
+#ifdef FILESYS
+/* -f: Format the file system? */
+static bool format_filesys;
+#endif
+
+/* -q: Power off after kernel tasks complete? */
+bool power_off_when_done;
+
+bool thread_tests;
+
+static void bss_init (void);
+static void paging_init (uint64_t mem_end);
+
+static char **read_command_line (void);
+static char **parse_options (char **argv);
+static void run_actions (char **argv);
+static void usage (void);
+
+static void print_stats (void);
+
+
+int main (void) NO_RETURN;
+
+/* Pintos main program. */
+int
+main (void) {
+	uint64_t mem_end;
+	char **argv;
+
+	/* BSS 영역을 초기화하고 머신의 RAM 크기를 가져온다. */
+	bss_init ();
+
+	/* Break command line into arguments and parse options. */
+	argv = read_command_line ();
+	argv = parse_options (argv);
+
+	/* Initialize ourselves as a thread so we can use locks,
+	   then enable console locking. */
+	thread_init ();
+	console_init ();
+	klog_init ();
+
+	/* Initialize memory system. */
+	mem_end = palloc_init ();
+	malloc_init ();
+	paging_init (mem_end);
+
+#ifdef USERPROG
+	tss_init ();
+	gdt_init ();
+#endif
+
+	/* Initialize interrupt handlers. */
+	intr_init ();
+	timer_init ();
+	kbd_init ();
+	input_init ();
+#ifdef USERPROG
+	exception_init ();
+	uaccess_init ();
+	syscall_init ();
+#endif
+	/* 스레드 스케줄러를 시작하고 인터럽트를 활성화한다. */
+	thread_start ();
+	serial_init_queue ();
+	klog_start ();
+	timer_calibrate ();
+#ifdef USERPROG
+	reaper_init ();
+	vdso_init ();
+	exec_cache_init ();
+#endif
+
+#ifdef FILESYS
+	/* Initialize file system. */
+	disk_init ();
+	filesys_init (format_filesys);
+#endif
+
+#ifdef VM
+	vm_init ();
+#endif
+
+	printf ("Boot complete.\n");
+
+	/* Run actions specified on kernel command line. */
+	//커널 명령줄에 지정된 동작들을 실행한다.
+	run_actions (argv);
+
+	/* Finish up. */
+	if (power_off_when_done)
+		power_off ();
+	thread_exit ();
+}
+
+/* Clear BSS */
+static void
+bss_init (void) {
+	/* The "BSS" is a segment that should be initialized to zeros.
+	   It isn't actually stored on disk or zeroed by the kernel
+	   loader, so we have to zero it ourselves.
+
+	   The start and end of the BSS segment is recorded by the
+	   linker as _start_bss and _end_bss.  See kernel.lds. */
+	extern char _start_bss, _end_bss;
+	memset (&_start_bss, 0, &_end_bss - &_start_bss);
+}
+
+/* Returns true if the CPU can map 1 GB pages
+   (CPUID.80000001H:EDX.Page1GB). */
+static bool
+cpu_has_gb_pages (void) {
+	uint32_t eax, ebx, ecx, edx;
+
+	cpuid (0x80000000, 0, &eax, &ebx, &ecx, &edx);
+	if (eax < 0x80000001)
+		return false;
+	cpuid (0x80000001, 0, &eax, &ebx, &ecx, &edx);
+	return (edx & (1 << 26)) != 0;
+}
+
+/* Returns true if physical memory [PA, PA + SIZE) can be direct-mapped
+   with one large page: both PA and its kernel virtual address must be
+   SIZE aligned, the chunk must end by MEM_END, and it must lie either
+   entirely inside or entirely outside the kernel text, since a page
+   has a single set of permissions. */
+static bool
+can_map_large (uint64_t pa, uint64_t size, uint64_t mem_end) {
+	extern char start, _end_kernel_text;
+	uint64_t va = (uint64_t) ptov (pa);
+	uint64_t text_start = (uint64_t) &start;
+	uint64_t text_end = (uint64_t) &_end_kernel_text;
+
+	if ((pa & (size - 1)) != 0 || (va & (size - 1)) != 0
+			|| pa + size > mem_end)
+		return false;
+	return va + size <= text_start || va >= text_end
+		|| (text_start <= va && va + size <= text_end);
+}
+
+/* 커널 가상 매핑으로 페이지 테이블을 채운 후,
+CPU가 새 페이지 디렉터리를 사용하도록 설정합니다.
+생성한 pml4를 base_pml4에 지정합니다. */
+static void
+paging_init (uint64_t mem_end) {
+	uint64_t *pml4, *pte;
+	int perm;
+	pml4 = base_pml4 = palloc_get_page (PAL_ASSERT | PAL_ZERO);
+
+	extern char start, _end_kernel_text;
+	bool gb_pages = cpu_has_gb_pages ();
+	// Maps physical address [0 ~ mem_end] to
+	//   [LOADER_KERN_BASE ~ LOADER_KERN_BASE + mem_end].
+	// Whole aligned 1 GB or 2 MB chunks get a single large page, which
+	// keeps the page tables and the TLB footprint of the direct map
+	// small.  The rest, including any chunk that only partly overlaps
+	// the read-only kernel text, is mapped with 4 kB pages.
+	for (uint64_t pa = 0, size; pa < mem_end; pa += size) {
+		uint64_t va = (uint64_t) ptov(pa);
+
+		if (gb_pages && can_map_large (pa, PDPE_PGSIZE, mem_end))
+			size = PDPE_PGSIZE;
+		else if (can_map_large (pa, PDE_PGSIZE, mem_end))
+			size = PDE_PGSIZE;
+		else
+			size = PGSIZE;
+
+		perm = PTE_P | PTE_W;
+		if ((uint64_t) &start <= va && va < (uint64_t) &_end_kernel_text)
+			perm &= ~PTE_W;
+
+		if (size == PGSIZE)
+			pte = pml4e_walk (pml4, va, 1);
+		else {
+			pte = pml4e_walk_large (pml4, va, size, 1);
+			perm |= PTE_PS;
+		}
+		if (pte != NULL)
+			*pte = pa | perm;
+	}
+
+	// reload cr3
+	pml4_activate(0);
+	pcid_init ();
+}
+
+/* Breaks the kernel command line into words and returns them as
+   an argv-like array. */
+static char **
+read_command_line (void) {
+	static char *argv[LOADER_ARGS_LEN / 2 + 1];
+	char *p, *end;
+	int argc;
+	int i;
+
+	argc = *(uint32_t *) ptov (LOADER_ARG_CNT);
+	p = ptov (LOADER_ARGS);
+	end = p + LOADER_ARGS_LEN;
+	for (i = 0; i < argc; i++) {
+		if (p >= end)
+			PANIC ("command line arguments overflow");
+
+		argv[i] = p;
+		p += strnlen (p, end - p) + 1;
+	}
+	argv[argc] = NULL;
+
+	/* Print kernel command line. */
+	printf ("Kernel command line:");
+	for (i = 0; i < argc; i++)
+		if (strchr (argv[i], ' ') == NULL)
+			printf (" %s", argv[i]);
+		else
+			printf (" '%s'", argv[i]);
+	printf ("\n");
+
+	return argv;
+}
+
+/* Parses options in ARGV[]
+   첫 번째 비옵션 인수를 반환한다. */
+static char **
+parse_options (char **argv) {
+	for (; *argv != NULL && **argv == '-'; argv++) {
+		char *save_ptr;
+		char *name = strtok_r (*argv, "=", &save_ptr);
+		char *value = strtok_r (NULL, "", &save_ptr);
+
+		if (!strcmp (name, "-h"))
+			usage ();
+		else if (!strcmp (name, "-q"))
+			power_off_when_done = true;
+#ifdef FILESYS
+		else if (!strcmp (name, "-f"))
+			format_filesys = true;
+#endif
+		else if (!strcmp (name, "-rs"))
+			random_init (atoi (value));
+		else if (!strcmp (name, "-mlfqs"))
+			thread_mlfqs = true;
+		else if (!strcmp (name, "-klog"))
+			klog_set_console_level (atoi (value));
+#ifdef USERPROG
+		else if (!strcmp (name, "-ul"))
+			user_page_limit = atoi (value);
+		else if (!strcmp (name, "-threads-tests"))
+			thread_tests = true;
+#endif
+		else
+			PANIC ("unknown option `%s' (use -h for help)", name);
+	}
+
+	return argv;
+}
+
+/* ARGV[1]에 지정된 작업(task)을 실행한다. */
+static void
+run_task (char **argv) {
+	const char *task = argv[1];
+	printf ("Executing '%s':\n", task);
+	//여기 안으로 들어가는 건가? 유저 프로그램이라고 인식이 된다면 여기 안으로?
+#ifdef USERPROG
+	if (thread_tests){	//현재 thread_tests가 false 이면 들어가지 않는다.
+		run_test (task);
+	} else {
+		process_wait (process_create_initd (task));  //테스트 이름 뒤의 인자를 가지고 process_create_initd을 먼저 호출한다.
+	}
+#else
+	run_test (task);
+#endif
+	printf ("Execution of '%s' complete.\n", task);
+}
+
+/* NULL 포인터 센티넬(null pointer sentinel)이 나올 때까지 argv[]에 지정된 모든 동작을 실행한다.*/
+static void
+run_actions (char **argv) {
+	/* An action. */
+	struct action {
+		char *name;                       /* 커널 명령줄에 지정된 실행 명령어 */
+		int argc;                         /* # action_name을 포함한 인자의 개수 */
+		void (*function) (char **argv);   /* 명령줄에 지정된 action name을 처리하는 함수 */
+	};
+
+	/* Table of supported actions. */
+	static const struct action actions[] = {
+		{"run", 2, run_task},
+#ifdef FILESYS
+		{"ls", 1, fsutil_ls},
+		{"cat", 2, fsutil_cat},
+		{"rm", 2, fsutil_rm},
+		{"put", 2, fsutil_put},
+		{"get", 2, fsutil_get},
+#endif
+		{NULL, 0, NULL},
+	};
+
+	while (*argv != NULL) {
+		const struct action *a;	
+		int i;
+
+		/* Find action name. */
+		for (a = actions; ; a++)			//a = 현재 actions가 된다.
+			if (a->name == NULL)			
+				PANIC ("unknown action `%s' (use -h for help)", *argv);
+			else if (!strcmp (*argv, a->name))
+				break;
+
+		/* Check for required arguments. */
+		for (i = 1; i < a->argc; i++)
+			if (argv[i] == NULL)
+				PANIC ("action `%s' requires %d argument(s)", *argv, a->argc - 1);
+
+		/* Invoke action and advance. */
+		a->function (argv);
+		argv += a->argc;
+	}
+
+}
+
+/* 커널 명령줄 도움말 메시지를 출력하고 머신의 전원을 끈다. */
+static void
+usage (void) {
+	printf ("\nCommand line syntax: [OPTION...] [ACTION...]\n"
+			"Options must precede actions.\n"
+			"Actions are executed in the order specified.\n"
+			"\nAvailable actions:\n"
+#ifdef USERPROG
+			"  run 'PROG [ARG...]' Run PROG and wait for it to complete.\n"
+#else
+			"  run TEST           Run TEST.\n"
+#endif
+#ifdef FILESYS
+			"  ls                 List files in the root directory.\n"
+			"  cat FILE           Print FILE to the console.\n"
+			"  rm FILE            Delete FILE.\n"
+			"Use these actions indirectly via `pintos' -g and -p options:\n"
+			"  put FILE           Put FILE into file system from scratch disk.\n"
+			"  get FILE           Get FILE from file system into scratch disk.\n"
+#endif
+			"\nOptions:\n"
+			"  -h                 Print this help message and power off.\n"
+			"  -q                 Power off VM after actions or on panic.\n"
+			"  -f                 Format file system disk during startup.\n"
+			"  -rs=SEED           Set random number seed to SEED.\n"
+			"  -mlfqs             Use multi-level feedback queue scheduler.\n"
+			"  -klog=LEVEL        Print kernel log records up to LEVEL (0-3).\n"
+#ifdef USERPROG
+			"  -ul=COUNT          Limit user memory to COUNT pages.\n"
+#endif
+			);
+	power_off ();
+}
+
+
+/* Bochs나 QEMU에서 실행 중인 경우, 현재 실행 중인 머신의 전원을 종료한다. */
+void
+power_off (void) {
+#ifdef FILESYS
+	filesys_done ();
+#endif
+
+	print_stats ();
+
+	printf ("Powering off...\n");
+	outw (0x604, 0x2000);               /* Poweroff command for qemu */
+	for (;;);
+}
+
+/* Print statistics about Pintos execution. */
+static void
+print_stats (void) {
+	timer_print_stats ();
+	thread_print_stats ();
+#ifdef FILESYS
+	disk_print_stats ();
+#endif
+	console_print_stats ();
+	kbd_print_stats ();
+#ifdef USERPROG
+	exception_print_stats ();
+	syscall_print_stats ();
+#endif
 }
\ No newline at end of file
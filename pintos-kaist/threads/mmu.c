@@ -1,308 +1,884 @@
-#include <stdbool.h>
-#include <stddef.h>
-#include <string.h>
-#include "threads/init.h"
-#include "threads/pte.h"
-#include "threads/palloc.h"
-#include "threads/thread.h"
-#include "threads/mmu.h"
-#include "intrinsic.h"
-
-static uint64_t *
-pgdir_walk (uint64_t *pdp, const uint64_t va, int create) {
-	int idx = PDX (va);
-	if (pdp) {
-		uint64_t *pte = (uint64_t *) pdp[idx];
-		if (!((uint64_t) pte & PTE_P)) {
-			if (create) {
-				uint64_t *new_page = palloc_get_page (PAL_ZERO);
-				if (new_page)
-					pdp[idx] = vtop (new_page) | PTE_U | PTE_W | PTE_P;
-				else
-					return NULL;
-			} else
-				return NULL;
-		}
-		return (uint64_t *) ptov (PTE_ADDR (pdp[idx]) + 8 * PTX (va));
-	}
-	return NULL;
-}
-
-static uint64_t *
-pdpe_walk (uint64_t *pdpe, const uint64_t va, int create) {
-	uint64_t *pte = NULL;
-	int idx = PDPE (va);
-	int allocated = 0;
-	if (pdpe) {
-		uint64_t *pde = (uint64_t *) pdpe[idx];
-		if (!((uint64_t) pde & PTE_P)) {
-			if (create) {
-				uint64_t *new_page = palloc_get_page (PAL_ZERO);
-				if (new_page) {
-					pdpe[idx] = vtop (new_page) | PTE_U | PTE_W | PTE_P;
-					allocated = 1;
-				} else
-					return NULL;
-			} else
-				return NULL;
-		}
-		pte = pgdir_walk (ptov (PTE_ADDR (pdpe[idx])), va, create);
-	}
-	if (pte == NULL && allocated) {
-		palloc_free_page ((void *) ptov (PTE_ADDR (pdpe[idx])));
-		pdpe[idx] = 0;
-	}
-	return pte;
-}
-
-/* Returns the address of the page table entry for virtual
- * address VADDR in page map level 4, pml4.
- * If PML4E does not have a page table for VADDR, behavior depends
- * on CREATE.  If CREATE is true, then a new page table is
- * created and a pointer into it is returned.  Otherwise, a null
- * pointer is returned. */
-uint64_t *
-pml4e_walk (uint64_t *pml4e, const uint64_t va, int create) {
-	uint64_t *pte = NULL;
-	int idx = PML4 (va);
-	int allocated = 0;
-	if (pml4e) {
-		uint64_t *pdpe = (uint64_t *) pml4e[idx];
-		if (!((uint64_t) pdpe & PTE_P)) {
-			if (create) {
-				uint64_t *new_page = palloc_get_page (PAL_ZERO);
-				if (new_page) {
-					pml4e[idx] = vtop (new_page) | PTE_U | PTE_W | PTE_P;
-					allocated = 1;
-				} else
-					return NULL;
-			} else
-				return NULL;
-		}
-		pte = pdpe_walk (ptov (PTE_ADDR (pml4e[idx])), va, create);
-	}
-	if (pte == NULL && allocated) {
-		palloc_free_page ((void *) ptov (PTE_ADDR (pml4e[idx])));
-		pml4e[idx] = 0;
-	}
-	return pte;
-}
-
-/* pml4(페이지 맵 레벨 4)를 새로 생성하며, 커널 가상 주소에 대한 매핑은 포함하지만 
-사용자 가상 주소에 대한 매핑은 포함하지 않습니다.
-메모리 할당에 실패하면 null 포인터를 반환하며, 그렇지 않으면 새 페이지 디렉터리를 반환합니다. */
-uint64_t *
-pml4_create (void) {
-	uint64_t *pml4 = palloc_get_page (0);
-	if (pml4)
-		memcpy (pml4, base_pml4, PGSIZE);
-	return pml4;
-}
-
-static bool
-pt_for_each (uint64_t *pt, pte_for_each_func *func, void *aux,
-		unsigned pml4_index, unsigned pdp_index, unsigned pdx_index) {
-	for (unsigned i = 0; i < PGSIZE / sizeof(uint64_t *); i++) {
-		uint64_t *pte = &pt[i];
-		if (((uint64_t) *pte) & PTE_P) {
-			void *va = (void *) (((uint64_t) pml4_index << PML4SHIFT) |
-								 ((uint64_t) pdp_index << PDPESHIFT) |
-								 ((uint64_t) pdx_index << PDXSHIFT) |
-								 ((uint64_t) i << PTXSHIFT));
-			if (!func (pte, va, aux))
-				return false;
-		}
-	}
-	return true;
-}
-
-static bool
-pgdir_for_each (uint64_t *pdp, pte_for_each_func *func, void *aux,
-		unsigned pml4_index, unsigned pdp_index) {
-	for (unsigned i = 0; i < PGSIZE / sizeof(uint64_t *); i++) {
-		uint64_t *pte = ptov((uint64_t *) pdp[i]);
-		if (((uint64_t) pte) & PTE_P)
-			if (!pt_for_each ((uint64_t *) PTE_ADDR (pte), func, aux,
-					pml4_index, pdp_index, i))
-				return false;
-	}
-	return true;
-}
-
-static bool
-pdp_for_each (uint64_t *pdp,
-		pte_for_each_func *func, void *aux, unsigned pml4_index) {
-	for (unsigned i = 0; i < PGSIZE / sizeof(uint64_t *); i++) {
-		uint64_t *pde = ptov((uint64_t *) pdp[i]);
-		if (((uint64_t) pde) & PTE_P)
-			if (!pgdir_for_each ((uint64_t *) PTE_ADDR (pde), func,
-					 aux, pml4_index, i))
-				return false;
-	}
-	return true;
-}
-
-/* 사용 가능한 모든 PTE 항목(커널의 항목 포함)에 FUNC을 적용합니다 */
-bool
-pml4_for_each (uint64_t *pml4, pte_for_each_func *func, void *aux) {
-	for (unsigned i = 0; i < PGSIZE / sizeof(uint64_t *); i++) {
-		uint64_t *pdpe = ptov((uint64_t *) pml4[i]);
-		if (((uint64_t) pdpe) & PTE_P)
-			if (!pdp_for_each ((uint64_t *) PTE_ADDR (pdpe), func, aux, i))
-				return false;
-	}
-	return true;
-}
-
-static void
-pt_destroy (uint64_t *pt) {
-	for (unsigned i = 0; i < PGSIZE / sizeof(uint64_t *); i++) {
-		uint64_t *pte = ptov((uint64_t *) pt[i]);
-		if (((uint64_t) pte) & PTE_P)
-			palloc_free_page ((void *) PTE_ADDR (pte));
-	}
-	palloc_free_page ((void *) pt);
-}
-
-static void
-pgdir_destroy (uint64_t *pdp) {
-	for (unsigned i = 0; i < PGSIZE / sizeof(uint64_t *); i++) {
-		uint64_t *pte = ptov((uint64_t *) pdp[i]);
-		if (((uint64_t) pte) & PTE_P)
-			pt_destroy (PTE_ADDR (pte));
-	}
-	palloc_free_page ((void *) pdp);
-}
-
-static void
-pdpe_destroy (uint64_t *pdpe) {
-	for (unsigned i = 0; i < PGSIZE / sizeof(uint64_t *); i++) {
-		uint64_t *pde = ptov((uint64_t *) pdpe[i]);
-		if (((uint64_t) pde) & PTE_P)
-			pgdir_destroy ((void *) PTE_ADDR (pde));
-	}
-	palloc_free_page ((void *) pdpe);
-}
-
-/* Destroys pml4e, freeing all the pages it references. */
-void
-pml4_destroy (uint64_t *pml4) {
-	if (pml4 == NULL)
-		return;
-	ASSERT (pml4 != base_pml4);
-
-	/* if PML4 (vaddr) >= 1, it's kernel space by define. */
-	uint64_t *pdpe = ptov ((uint64_t *) pml4[0]);
-	if (((uint64_t) pdpe) & PTE_P)
-		pdpe_destroy ((void *) PTE_ADDR (pdpe));
-	palloc_free_page ((void *) pml4);
-}
-
-/* Loads page directory PD into the CPU's page directory base
- * register. */
-void
-pml4_activate (uint64_t *pml4) {
-	lcr3 (vtop (pml4 ? pml4 : base_pml4));
-}
-
-/* pml4에서 사용자 가상 주소 UADDR에 대응하는 물리 주소를 조회합니다.
-그 물리 주소에 해당하는 커널 가상 주소를 반환하며, UADDR가 매핑되지 않은 경우에는 null 포인터를 반환합니다. */
-void *
-pml4_get_page (uint64_t *pml4, const void *uaddr) {
-	ASSERT (is_user_vaddr (uaddr));
-
-	uint64_t *pte = pml4e_walk (pml4, (uint64_t) uaddr, 0);
-
-	if (pte && (*pte & PTE_P))
-		return ptov (PTE_ADDR (*pte)) + pg_ofs (uaddr);
-	return NULL;
-}
-
-/* PML4(페이지 맵 레벨 4)에 사용자 가상 페이지 UPAGE에서 커널 가상 주소 KPAGE로 식별되는 물리 프레임에 대한 매핑을 추가합니다.
-UPAGE는 이미 매핑되어 있지 않아야 합니다. KPAGE는 보통 palloc_get_page()를 통해 사용자 풀에서 얻은 페이지여야 합니다.
-WRITABLE이 true이면 새 페이지는 읽기/쓰기 가능하며, 그렇지 않으면 읽기 전용으로 설정됩니다.
-성공 시 true를 반환하고, 메모리 할당 실패 시 false를 반환합니다. */
-bool
-pml4_set_page (uint64_t *pml4, void *upage, void *kpage, bool rw) {
-	ASSERT (pg_ofs (upage) == 0);
-	ASSERT (pg_ofs (kpage) == 0);
-	ASSERT (is_user_vaddr (upage));
-	ASSERT (pml4 != base_pml4);
-
-	uint64_t *pte = pml4e_walk (pml4, (uint64_t) upage, 1);
-
-	if (pte)
-		*pte = vtop (kpage) | PTE_P | (rw ? PTE_W : 0) | PTE_U;
-	return pte != NULL;
-}
-
-/* Marks user virtual page UPAGE "not present" in page
- * directory PD.  Later accesses to the page will fault.  Other
- * bits in the page table entry are preserved.
- * UPAGE need not be mapped. */
-void
-pml4_clear_page (uint64_t *pml4, void *upage) {
-	uint64_t *pte;
-	ASSERT (pg_ofs (upage) == 0);
-	ASSERT (is_user_vaddr (upage));
-
-	pte = pml4e_walk (pml4, (uint64_t) upage, false);
-
-	if (pte != NULL && (*pte & PTE_P) != 0) {
-		*pte &= ~PTE_P;
-		if (rcr3 () == vtop (pml4))
-			invlpg ((uint64_t) upage);
-	}
-}
-
-/* Returns true if the PTE for virtual page VPAGE in PML4 is dirty,
- * that is, if the page has been modified since the PTE was
- * installed.
- * Returns false if PML4 contains no PTE for VPAGE. */
-bool
-pml4_is_dirty (uint64_t *pml4, const void *vpage) {
-	uint64_t *pte = pml4e_walk (pml4, (uint64_t) vpage, false);
-	return pte != NULL && (*pte & PTE_D) != 0;
-}
-
-/* Set the dirty bit to DIRTY in the PTE for virtual page VPAGE
- * in PML4. */
-void
-pml4_set_dirty (uint64_t *pml4, const void *vpage, bool dirty) {
-	uint64_t *pte = pml4e_walk (pml4, (uint64_t) vpage, false);
-	if (pte) {
-		if (dirty)
-			*pte |= PTE_D;
-		else
-			*pte &= ~(uint32_t) PTE_D;
-
-		if (rcr3 () == vtop (pml4))
-			invlpg ((uint64_t) vpage);
-	}
-}
-
-/* Returns true if the PTE for virtual page VPAGE in PML4 has been
- * accessed recently, that is, between the time the PTE was
- * installed and the last time it was cleared.  Returns false if
- * PML4 contains no PTE for VPAGE. */
-bool
-pml4_is_accessed (uint64_t *pml4, const void *vpage) {
-	uint64_t *pte = pml4e_walk (pml4, (uint64_t) vpage, false);
-	return pte != NULL && (*pte & PTE_A) != 0;
-}
-
-/* Sets the accessed bit to ACCESSED in the PTE for virtual page
-   VPAGE in PD. */
-void
-pml4_set_accessed (uint64_t *pml4, const void *vpage, bool accessed) {
-	uint64_t *pte = pml4e_walk (pml4, (uint64_t) vpage, false);
-	if (pte) {
-		if (accessed)
-			*pte |= PTE_A;
-		else
-			*pte &= ~(uint32_t) PTE_A;
-
-		if (rcr3 () == vtop (pml4))
-			invlpg ((uint64_t) vpage);
-	}
-}
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "threads/init.h"
+#include "threads/interrupt.h"
+#include "threads/pte.h"
+#include "threads/palloc.h"
+#include "threads/thread.h"
+#include "threads/mmu.h"
+#include "intrinsic.h"
+
+/* Page-table pages.
+ *
+ * Every table page counts its non-empty entries in bits 52-61 of the
+ * entry that points to it, which the CPU ignores in non-leaf entries.
+ * A count goes up when an entry first becomes non-zero; entries are
+ * never zeroed again before teardown, since pml4_clear_page() only
+ * drops PTE_P.  pml4_destroy() uses the counts to stop scanning a
+ * table once all of its entries have been seen, and to skip the scan
+ * of an empty one altogether.  Leaves written directly by
+ * paging_init() are not counted; the kernel's tables are never torn
+ * down.
+ *
+ * Teardown also zeroes each entry as it goes, so that freed tables
+ * can go into a small cache of zeroed pages.  Table allocation takes
+ * from the cache first, which keeps fork/exec churn off the kernel
+ * pool's lock and out of memset.  All page tables come from the kernel
+ * pool, so one cache is enough.  A cached page links to the next
+ * through its first word, which is cleared again on allocation. */
+#define PTE_CNT_SHIFT 52
+#define PTE_CNT_MASK (0x3ffULL << PTE_CNT_SHIFT)
+#define pte_cnt(e) ((unsigned) (((e) & PTE_CNT_MASK) >> PTE_CNT_SHIFT))
+
+#define PT_CACHE_MAX 64                 /* Most page-table pages cached. */
+
+static uint64_t *pt_cache;              /* Cached zeroed pages. */
+static size_t pt_cache_cnt;             /* Number of pages in pt_cache. */
+
+/* Returns a zeroed page for a page table, or NULL if memory is
+ * exhausted. */
+static uint64_t *
+pt_page_alloc (void) {
+	enum intr_level old_level = intr_disable ();
+	uint64_t *page = pt_cache;
+	if (page != NULL) {
+		pt_cache = (uint64_t *) page[0];
+		pt_cache_cnt--;
+	}
+	intr_set_level (old_level);
+
+	if (page == NULL)
+		return palloc_get_page (PAL_ZERO);
+	page[0] = 0;
+	return page;
+}
+
+/* Releases page-table page PAGE, which must be all zeroes. */
+static void
+pt_page_free (uint64_t *page) {
+	enum intr_level old_level = intr_disable ();
+	if (pt_cache_cnt < PT_CACHE_MAX) {
+		page[0] = (uint64_t) pt_cache;
+		pt_cache = page;
+		pt_cache_cnt++;
+		page = NULL;
+	}
+	intr_set_level (old_level);
+
+	if (page != NULL)
+		palloc_free_page (page);
+}
+
+/* Adds DELTA to the occupancy count kept in entry OWNER.  The root
+ * pml4 has no owner, so OWNER may be NULL. */
+static void
+pte_cnt_add (uint64_t *owner, int delta) {
+	if (owner != NULL)
+		*owner += (uint64_t) (int64_t) delta << PTE_CNT_SHIFT;
+}
+
+static uint64_t *
+pgdir_walk (uint64_t *pdp, uint64_t *owner, const uint64_t va, int create) {
+	int idx = PDX (va);
+	if (pdp) {
+		uint64_t *pte = (uint64_t *) pdp[idx];
+		if ((uint64_t) pte & PTE_PS)
+			return NULL;
+		if (!((uint64_t) pte & PTE_P)) {
+			if (create) {
+				uint64_t *new_page = pt_page_alloc ();
+				if (new_page) {
+					if (pdp[idx] == 0)
+						pte_cnt_add (owner, 1);
+					pdp[idx] = vtop (new_page) | PTE_U | PTE_W | PTE_P;
+				} else
+					return NULL;
+			} else
+				return NULL;
+		}
+		return (uint64_t *) ptov (PTE_ADDR (pdp[idx]) + 8 * PTX (va));
+	}
+	return NULL;
+}
+
+static uint64_t *
+pdpe_walk (uint64_t *pdpe, uint64_t *owner, const uint64_t va, int create) {
+	uint64_t *pte = NULL;
+	int idx = PDPE (va);
+	int allocated = 0;
+	if (pdpe) {
+		uint64_t *pde = (uint64_t *) pdpe[idx];
+		if ((uint64_t) pde & PTE_PS)
+			return NULL;
+		if (!((uint64_t) pde & PTE_P)) {
+			if (create) {
+				uint64_t *new_page = pt_page_alloc ();
+				if (new_page) {
+					pdpe[idx] = vtop (new_page) | PTE_U | PTE_W | PTE_P;
+					pte_cnt_add (owner, 1);
+					allocated = 1;
+				} else
+					return NULL;
+			} else
+				return NULL;
+		}
+		pte = pgdir_walk (ptov (PTE_ADDR (pdpe[idx])), &pdpe[idx], va, create);
+	}
+	if (pte == NULL && allocated) {
+		pt_page_free ((void *) ptov (PTE_ADDR (pdpe[idx])));
+		pdpe[idx] = 0;
+		pte_cnt_add (owner, -1);
+	}
+	return pte;
+}
+
+/* Returns the address of the page table entry for virtual
+ * address VADDR in page map level 4, pml4.
+ * If PML4E does not have a page table for VADDR, behavior depends
+ * on CREATE.  If CREATE is true, then a new page table is
+ * created and a pointer into it is returned.  Otherwise, a null
+ * pointer is returned.  A null pointer is also returned if VADDR
+ * lies in a large page, which has no page table entry. */
+uint64_t *
+pml4e_walk (uint64_t *pml4e, const uint64_t va, int create) {
+	uint64_t *pte = NULL;
+	int idx = PML4 (va);
+	int allocated = 0;
+	if (pml4e) {
+		uint64_t *pdpe = (uint64_t *) pml4e[idx];
+		if (!((uint64_t) pdpe & PTE_P)) {
+			if (create) {
+				uint64_t *new_page = pt_page_alloc ();
+				if (new_page) {
+					pml4e[idx] = vtop (new_page) | PTE_U | PTE_W | PTE_P;
+					allocated = 1;
+				} else
+					return NULL;
+			} else
+				return NULL;
+		}
+		pte = pdpe_walk (ptov (PTE_ADDR (pml4e[idx])), &pml4e[idx], va, create);
+	}
+	if (pte == NULL && allocated) {
+		pt_page_free ((void *) ptov (PTE_ADDR (pml4e[idx])));
+		pml4e[idx] = 0;
+	}
+	return pte;
+}
+
+/* Returns the page-directory entry that points to the page table
+ * holding the PTE for VA.  The tables above it must exist. */
+static uint64_t *
+pde_of (uint64_t *pml4, const uint64_t va) {
+	uint64_t *pdpt = ptov (PTE_ADDR (pml4[PML4 (va)]));
+	uint64_t *pd = ptov (PTE_ADDR (pdpt[PDPE (va)]));
+	return &pd[PDX (va)];
+}
+
+/* Returns the table that entry IDX of TABLE points to, allocating a
+ * zeroed one if the entry is empty and CREATE is true.  OWNER is the
+ * entry that points to TABLE.  Returns NULL
+ * if there is no table, allocation fails, or the entry maps a large
+ * page. */
+static uint64_t *
+next_table (uint64_t *table, uint64_t *owner, int idx, int create) {
+	if (table[idx] & PTE_PS)
+		return NULL;
+	if (!(table[idx] & PTE_P)) {
+		if (!create)
+			return NULL;
+		uint64_t *new_page = pt_page_alloc ();
+		if (new_page == NULL)
+			return NULL;
+		table[idx] = vtop (new_page) | PTE_U | PTE_W | PTE_P;
+		pte_cnt_add (owner, 1);
+	}
+	return ptov (PTE_ADDR (table[idx]));
+}
+
+/* Returns the address of the entry that maps VA with a large page of
+ * SIZE bytes: the PDE for PDE_PGSIZE, the PDPE for PDPE_PGSIZE.  The
+ * upper tables are created if CREATE is true.  Returns NULL if they
+ * are missing or cannot be allocated, or if a larger page already
+ * covers VA.  Tables created before a failure are left in place,
+ * empty. */
+uint64_t *
+pml4e_walk_large (uint64_t *pml4, const uint64_t va, uint64_t size,
+		int create) {
+	ASSERT (size == PDE_PGSIZE || size == PDPE_PGSIZE);
+
+	uint64_t *pdpt = next_table (pml4, NULL, PML4 (va), create);
+	if (pdpt == NULL)
+		return NULL;
+	if (size == PDPE_PGSIZE)
+		return &pdpt[PDPE (va)];
+	uint64_t *pd = next_table (pdpt, &pml4[PML4 (va)], PDPE (va), create);
+	if (pd == NULL)
+		return NULL;
+	return &pd[PDX (va)];
+}
+
+/* Returns the entry that maps VA in PML4, without creating anything:
+ * the page table entry, or the PDE or PDPE if VA lies in a large
+ * page.  Returns NULL if no table covers VA. */
+static uint64_t *
+pml4_lookup (uint64_t *pml4, const uint64_t va) {
+	uint64_t *pte = pml4e_walk (pml4, va, false);
+	if (pte != NULL)
+		return pte;
+
+	uint64_t *pdpt = next_table (pml4, NULL, PML4 (va), false);
+	if (pdpt == NULL)
+		return NULL;
+	if (pdpt[PDPE (va)] & PTE_PS)
+		return &pdpt[PDPE (va)];
+	uint64_t *pd = next_table (pdpt, NULL, PDPE (va), false);
+	if (pd != NULL && (pd[PDX (va)] & PTE_PS))
+		return &pd[PDX (va)];
+	return NULL;
+}
+
+/* pml4(페이지 맵 레벨 4)를 새로 생성하며, 커널 가상 주소에 대한 매핑은 포함하지만 
+사용자 가상 주소에 대한 매핑은 포함하지 않습니다.
+메모리 할당에 실패하면 null 포인터를 반환하며, 그렇지 않으면 새 페이지 디렉터리를 반환합니다. */
+uint64_t *
+pml4_create (void) {
+	uint64_t *pml4 = pt_page_alloc ();
+	if (pml4)
+		memcpy (pml4, base_pml4, PGSIZE);
+	return pml4;
+}
+
+static bool
+pt_for_each (uint64_t *pt, pte_for_each_func *func, void *aux,
+		unsigned pml4_index, unsigned pdp_index, unsigned pdx_index) {
+	for (unsigned i = 0; i < PGSIZE / sizeof(uint64_t *); i++) {
+		uint64_t *pte = &pt[i];
+		if (((uint64_t) *pte) & PTE_P) {
+			void *va = (void *) (((uint64_t) pml4_index << PML4SHIFT) |
+								 ((uint64_t) pdp_index << PDPESHIFT) |
+								 ((uint64_t) pdx_index << PDXSHIFT) |
+								 ((uint64_t) i << PTXSHIFT));
+			if (!func (pte, va, aux))
+				return false;
+		}
+	}
+	return true;
+}
+
+static bool
+pgdir_for_each (uint64_t *pdp, pte_for_each_func *func, void *aux,
+		unsigned pml4_index, unsigned pdp_index) {
+	for (unsigned i = 0; i < PGSIZE / sizeof(uint64_t *); i++) {
+		uint64_t *pte = ptov((uint64_t *) pdp[i]);
+		if ((pdp[i] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)) {
+			void *va = (void *) (((uint64_t) pml4_index << PML4SHIFT) |
+								 ((uint64_t) pdp_index << PDPESHIFT) |
+								 ((uint64_t) i << PDXSHIFT));
+			if (!func (&pdp[i], va, aux))
+				return false;
+		} else if (((uint64_t) pte) & PTE_P)
+			if (!pt_for_each ((uint64_t *) PTE_ADDR (pte), func, aux,
+					pml4_index, pdp_index, i))
+				return false;
+	}
+	return true;
+}
+
+static bool
+pdp_for_each (uint64_t *pdp,
+		pte_for_each_func *func, void *aux, unsigned pml4_index) {
+	for (unsigned i = 0; i < PGSIZE / sizeof(uint64_t *); i++) {
+		uint64_t *pde = ptov((uint64_t *) pdp[i]);
+		if ((pdp[i] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)) {
+			void *va = (void *) (((uint64_t) pml4_index << PML4SHIFT) |
+								 ((uint64_t) i << PDPESHIFT));
+			if (!func (&pdp[i], va, aux))
+				return false;
+		} else if (((uint64_t) pde) & PTE_P)
+			if (!pgdir_for_each ((uint64_t *) PTE_ADDR (pde), func,
+					 aux, pml4_index, i))
+				return false;
+	}
+	return true;
+}
+
+/* 사용 가능한 모든 PTE 항목(커널의 항목 포함)에 FUNC을 적용합니다.
+ * A large page is passed to FUNC as its PDE or PDPE (PTE_PS set). */
+bool
+pml4_for_each (uint64_t *pml4, pte_for_each_func *func, void *aux) {
+	for (unsigned i = 0; i < PGSIZE / sizeof(uint64_t *); i++) {
+		uint64_t *pdpe = ptov((uint64_t *) pml4[i]);
+		if (((uint64_t) pdpe) & PTE_P)
+			if (!pdp_for_each ((uint64_t *) PTE_ADDR (pdpe), func, aux, i))
+				return false;
+	}
+	return true;
+}
+
+/* Frees the frames mapped by page table PT, which has CNT non-empty
+ * entries, and then PT itself. */
+static void
+pt_destroy (uint64_t *pt, unsigned cnt) {
+	for (unsigned i = 0; cnt > 0 && i < PGSIZE / sizeof(uint64_t *); i++) {
+		if (pt[i] == 0)
+			continue;
+		if ((pt[i] & (PTE_P | PTE_NOFREE)) == PTE_P)
+			palloc_free_page (ptov (PTE_ADDR (pt[i])));
+		pt[i] = 0;
+		cnt--;
+	}
+	pt_page_free (pt);
+}
+
+static void
+pgdir_destroy (uint64_t *pdp, unsigned cnt) {
+	for (unsigned i = 0; cnt > 0 && i < PGSIZE / sizeof(uint64_t *); i++) {
+		uint64_t pde = pdp[i];
+		if (pde == 0)
+			continue;
+		ASSERT (!(pde & PTE_PS));
+		pt_destroy (ptov (PTE_ADDR (pde)), pte_cnt (pde));
+		pdp[i] = 0;
+		cnt--;
+	}
+	pt_page_free (pdp);
+}
+
+static void
+pdpe_destroy (uint64_t *pdpe, unsigned cnt) {
+	for (unsigned i = 0; cnt > 0 && i < PGSIZE / sizeof(uint64_t *); i++) {
+		uint64_t pdpte = pdpe[i];
+		if (pdpte == 0)
+			continue;
+		ASSERT (!(pdpte & PTE_PS));
+		pgdir_destroy (ptov (PTE_ADDR (pdpte)), pte_cnt (pdpte));
+		pdpe[i] = 0;
+		cnt--;
+	}
+	pt_page_free (pdpe);
+}
+
+/* Destroys pml4e, freeing all the pages it references. */
+void
+pml4_destroy (uint64_t *pml4) {
+	if (pml4 == NULL)
+		return;
+	ASSERT (pml4 != base_pml4);
+
+	/* if PML4 (vaddr) >= 1, it's kernel space by define. */
+	if (pml4[0] & PTE_P)
+		pdpe_destroy (ptov (PTE_ADDR (pml4[0])), pte_cnt (pml4[0]));
+
+	/* The rest is the copy of base_pml4 plus the PCID tag. */
+	memset (pml4, 0, PGSIZE);
+	pt_page_free (pml4);
+}
+
+/* Process-context identifiers (PCIDs).
+ *
+ * With CR4.PCIDE set, every TLB entry is tagged with the PCID held in
+ * the low 12 bits of CR3, and a CR3 load with bit 63 set keeps the
+ * entries of the incoming PCID.  Each user pml4 therefore carries a tag
+ * (generation, PCID), stored in its otherwise unused, non-present last
+ * entry.  PCIDs come from a bump allocator; when it runs dry the
+ * generation is advanced, which retires every outstanding tag at once.
+ * A pml4 with a stale tag just gets a fresh PCID and a flushing CR3 load
+ * the next time it is activated, so a recycled PCID never sees entries
+ * of its previous owner.  PCID 0 belongs to base_pml4, whose mappings
+ * never change after paging_init(). */
+#define PCID_CNT 4096                   /* Number of PCIDs. */
+#define PML4_ASID_SLOT 511              /* pml4 entry that holds the tag. */
+#define CR3_NOFLUSH (1ULL << 63)        /* Keep TLB entries of the PCID. */
+#define CR4_PCIDE (1 << 17)             /* Enable PCIDs. */
+#define CPUID_1_ECX_PCID (1 << 17)      /* CPUID.01H:ECX.PCID. */
+#define CPUID_7_EBX_INVPCID (1 << 10)   /* CPUID.07H:EBX.INVPCID. */
+#define INVPCID_ADDR 0                  /* Individual-address invalidation. */
+#define INVPCID_CONTEXT 1               /* Single-context invalidation. */
+
+/* Tag layout: bit 0 (PTE_P) stays clear, so the CPU ignores the entry. */
+#define ASID_MAKE(gen, pcid) (((uint64_t) (gen) << 13) | ((uint64_t) (pcid) << 1))
+#define ASID_PCID(tag) (((tag) >> 1) & (PCID_CNT - 1))
+#define ASID_GEN(tag) ((tag) >> 13)
+
+static bool pcid_enabled;               /* CR4.PCIDE is set. */
+static bool invpcid_enabled;            /* INVPCID is available. */
+static uint64_t pcid_gen = 1;           /* Current PCID generation. */
+static unsigned pcid_next = 1;          /* Next free PCID this generation. */
+
+/* Turns on PCIDs if the CPU supports them.  Must be called with
+ * base_pml4 loaded, since CR4.PCIDE can only be set while CR3[11:0]
+ * is zero. */
+void
+pcid_init (void) {
+	uint32_t eax, ebx, ecx, edx;
+
+	cpuid (1, 0, &eax, &ebx, &ecx, &edx);
+	if (!(ecx & CPUID_1_ECX_PCID))
+		return;
+	cpuid (0, 0, &eax, &ebx, &ecx, &edx);
+	if (eax >= 7) {
+		cpuid (7, 0, &eax, &ebx, &ecx, &edx);
+		invpcid_enabled = (ebx & CPUID_7_EBX_INVPCID) != 0;
+	}
+
+	ASSERT ((rcr3 () & PGMASK) == 0);
+	lcr4 (rcr4 () | CR4_PCIDE);
+	pcid_enabled = true;
+}
+
+/* Returns a PCID that has not been handed out in the current
+ * generation, starting a new generation if necessary. */
+static unsigned
+pcid_alloc (void) {
+	ASSERT (intr_get_level () == INTR_OFF);
+	if (pcid_next == PCID_CNT) {
+		pcid_gen++;
+		pcid_next = 1;
+	}
+	return pcid_next++;
+}
+
+/* Returns true if PML4 is the page table the CPU is using. */
+static bool
+pml4_is_active (uint64_t *pml4) {
+	return PTE_ADDR (rcr3 ()) == vtop (pml4);
+}
+
+/* Drops any TLB entry for user page VA of PML4.  The active address
+ * space uses invlpg.  Another address space with a live PCID either
+ * gets a targeted invpcid or, without INVPCID, loses its tag so that
+ * its next activation flushes.  Without PCIDs nothing else is cached. */
+static void
+tlb_invalidate_page (uint64_t *pml4, uint64_t va) {
+	if (pml4_is_active (pml4))
+		invlpg (va);
+	else if (pcid_enabled) {
+		uint64_t tag = pml4[PML4_ASID_SLOT];
+		if (tag != 0 && ASID_GEN (tag) == pcid_gen) {
+			if (invpcid_enabled)
+				invpcid (INVPCID_ADDR, ASID_PCID (tag), va);
+			else
+				pml4[PML4_ASID_SLOT] = 0;
+		}
+	}
+}
+
+/* Drops every TLB entry for the user pages of PML4. */
+static void
+tlb_invalidate_all (uint64_t *pml4) {
+	if (pml4_is_active (pml4))
+		/* Reloading CR3 without the no-flush bit drops the entries
+		 * of the current PCID (or all non-global ones). */
+		lcr3 (rcr3 () & ~CR3_NOFLUSH);
+	else if (pcid_enabled) {
+		uint64_t tag = pml4[PML4_ASID_SLOT];
+		if (tag != 0 && ASID_GEN (tag) == pcid_gen) {
+			if (invpcid_enabled)
+				invpcid (INVPCID_CONTEXT, ASID_PCID (tag), 0);
+			else
+				pml4[PML4_ASID_SLOT] = 0;
+		}
+	}
+}
+
+/* Starts a TLB batch for PML4 in the current thread.  Until
+ * tlb_batch_flush(), page-table changes to PML4 made through this
+ * file are recorded in B instead of being invalidated one by one, so
+ * the caller must not rely on the old translations being gone. */
+void
+tlb_batch_begin (struct tlb_batch *b, uint64_t *pml4) {
+	struct thread *curr = thread_current ();
+
+	ASSERT (curr->tlb_batch == NULL);
+	b->pml4 = pml4;
+	b->cnt = 0;
+	b->flush_all = false;
+	b->frame_cnt = 0;
+	curr->tlb_batch = b;
+}
+
+/* Queues user page VA of B's address space for invalidation.  Once
+ * more than TLB_BATCH_MAX pages are queued, B switches to a single
+ * full flush. */
+void
+tlb_batch_add (struct tlb_batch *b, const void *va) {
+	if (b->flush_all)
+		return;
+	if (b->cnt == TLB_BATCH_MAX)
+		b->flush_all = true;
+	else
+		b->va[b->cnt++] = (uint64_t) pg_round_down (va);
+}
+
+/* Performs the invalidations queued in B, then frees the frames it
+ * holds, leaving B open and empty. */
+static void
+tlb_batch_drain (struct tlb_batch *b) {
+	if (b->flush_all)
+		tlb_invalidate_all (b->pml4);
+	else
+		for (size_t i = 0; i < b->cnt; i++)
+			tlb_invalidate_page (b->pml4, b->va[i]);
+	b->cnt = 0;
+	b->flush_all = false;
+	for (size_t i = 0; i < b->frame_cnt; i++)
+		palloc_free_page (b->frames[i]);
+	b->frame_cnt = 0;
+}
+
+/* Performs the invalidations queued in B and closes the batch. */
+void
+tlb_batch_flush (struct tlb_batch *b) {
+	struct thread *curr = thread_current ();
+
+	ASSERT (curr->tlb_batch == b);
+	tlb_batch_drain (b);
+	curr->tlb_batch = NULL;
+}
+
+/* Notes that the entry for user page VA of PML4 changed: queues it in
+ * the current thread's open batch for PML4, or invalidates it now. */
+static void
+tlb_note_change (uint64_t *pml4, uint64_t va) {
+	struct tlb_batch *b = thread_current ()->tlb_batch;
+
+	if (b != NULL && b->pml4 == pml4)
+		tlb_batch_add (b, (void *) va);
+	else
+		tlb_invalidate_page (pml4, va);
+}
+
+/* Drops a reference to KPAGE, a frame just unmapped from PML4 with
+ * tlb_note_change().  With a batch open for PML4, waits for its flush,
+ * draining it first if it holds as many frames as it can. */
+static void
+tlb_free_frame (uint64_t *pml4, void *kpage) {
+	struct tlb_batch *b = thread_current ()->tlb_batch;
+
+	if (b == NULL || b->pml4 != pml4) {
+		palloc_free_page (kpage);
+		return;
+	}
+	if (b->frame_cnt == TLB_BATCH_MAX)
+		tlb_batch_drain (b);
+	b->frames[b->frame_cnt++] = kpage;
+}
+
+/* Loads page directory PD into the CPU's page directory base
+ * register.  With PCIDs, switching back to a pml4 whose tag is still
+ * current keeps its TLB entries. */
+void
+pml4_activate (uint64_t *pml4) {
+	uint64_t cr3;
+	enum intr_level old_level;
+
+	if (!pcid_enabled) {
+		lcr3 (vtop (pml4 ? pml4 : base_pml4));
+		return;
+	}
+	if (pml4 == NULL || pml4 == base_pml4) {
+		lcr3 (vtop (base_pml4) | CR3_NOFLUSH);
+		return;
+	}
+
+	old_level = intr_disable ();
+	cr3 = vtop (pml4);
+	uint64_t tag = pml4[PML4_ASID_SLOT];
+	if (tag != 0 && ASID_GEN (tag) == pcid_gen)
+		cr3 |= ASID_PCID (tag) | CR3_NOFLUSH;
+	else {
+		unsigned pcid = pcid_alloc ();
+		pml4[PML4_ASID_SLOT] = ASID_MAKE (pcid_gen, pcid);
+		cr3 |= pcid;
+	}
+	lcr3 (cr3);
+	intr_set_level (old_level);
+}
+
+/* pml4에서 사용자 가상 주소 UADDR에 대응하는 물리 주소를 조회합니다.
+그 물리 주소에 해당하는 커널 가상 주소를 반환하며, UADDR가 매핑되지 않은 경우에는 null 포인터를 반환합니다. */
+void *
+pml4_get_page (uint64_t *pml4, const void *uaddr) {
+	ASSERT (is_user_vaddr (uaddr));
+
+	uint64_t *pte = pml4_lookup (pml4, (uint64_t) uaddr);
+
+	if (pte && (*pte & PTE_P)) {
+		if (*pte & PTE_PS)
+			return ptov (PTE_ADDR (*pte))
+				+ ((uint64_t) uaddr & (PDE_PGSIZE - 1));
+		return ptov (PTE_ADDR (*pte)) + pg_ofs (uaddr);
+	}
+	return NULL;
+}
+
+/* PML4(페이지 맵 레벨 4)에 사용자 가상 페이지 UPAGE에서 커널 가상 주소 KPAGE로 식별되는 물리 프레임에 대한 매핑을 추가합니다.
+UPAGE는 이미 매핑되어 있지 않아야 합니다. KPAGE는 보통 palloc_get_page()를 통해 사용자 풀에서 얻은 페이지여야 합니다.
+WRITABLE이 true이면 새 페이지는 읽기/쓰기 가능하며, 그렇지 않으면 읽기 전용으로 설정됩니다.
+성공 시 true를 반환하고, 메모리 할당 실패 시 false를 반환합니다. */
+bool
+pml4_set_page (uint64_t *pml4, void *upage, void *kpage, bool rw) {
+	ASSERT (pg_ofs (upage) == 0);
+	ASSERT (pg_ofs (kpage) == 0);
+	ASSERT (is_user_vaddr (upage));
+	ASSERT (pml4 != base_pml4);
+
+	uint64_t *pte = pml4e_walk (pml4, (uint64_t) upage, 1);
+
+	if (pte) {
+		bool was_present = (*pte & PTE_P) != 0;
+		if (*pte == 0)
+			pte_cnt_add (pde_of (pml4, (uint64_t) upage), 1);
+		*pte = vtop (kpage) | PTE_P | (rw ? PTE_W : 0) | PTE_U;
+		if (was_present)
+			tlb_note_change (pml4, (uint64_t) upage);
+	}
+	return pte != NULL;
+}
+
+/* Like pml4_set_page(), but maps KPAGE read-only and leaves it to its
+ * owner: pml4_destroy() does not free it.  For frames, such as the
+ * vDSO time page, that many processes map at once. */
+bool
+pml4_set_shared_page (uint64_t *pml4, void *upage, void *kpage) {
+	if (!pml4_set_page (pml4, upage, kpage, false))
+		return false;
+	*pml4e_walk (pml4, (uint64_t) upage, 0) |= PTE_NOFREE;
+	return true;
+}
+
+/* Copy-on-write frames.
+ *
+ * A frame can be mapped in more than one place, or queued in a pipe,
+ * by taking extra references to it with palloc_page_ref().  Mappings
+ * of a shared frame that should be writable are entered read-only
+ * with PTE_COW instead of PTE_W.  The first store through one, by the
+ * process or by the kernel through copy_to_user(), faults into
+ * pml4_cow_fault(), which gives the mapping a private copy, or just
+ * makes it writable if no other reference is left by then. */
+
+/* Mappings whose frame must stay where it is. */
+#define PTE_NOSHARE (PTE_PIN | PTE_SHM)
+
+/* Returns the entry mapping user page UPAGE of PML4 with an ordinary
+ * 4 kB page that the mapping owns, or a null pointer if there is no
+ * such entry. */
+static uint64_t *
+owned_pte (uint64_t *pml4, const void *upage) {
+	uint64_t *pte = pml4_lookup (pml4, (uint64_t) upage);
+
+	if (pte == NULL || (*pte & (PTE_P | PTE_U | PTE_PS | PTE_NOFREE))
+			!= (PTE_P | PTE_U))
+		return NULL;
+	return pte;
+}
+
+/* Keeps the frame mapped at user page UPAGE of PML4 from ever being
+ * shared, because the kernel writes to it through its kernel address,
+ * which copy-on-write would not see.  UPAGE must be mapped. */
+void
+pml4_pin_page (uint64_t *pml4, void *upage) {
+	uint64_t *pte = owned_pte (pml4, upage);
+
+	ASSERT (pte != NULL);
+	*pte |= PTE_PIN;
+}
+
+/* Shares the frame mapped at user page UPAGE of PML4 with the caller:
+ * takes a reference to it for the caller and, if UPAGE was writable,
+ * makes it copy-on-write, so that the caller sees the contents as of
+ * now.  Returns the frame's kernel virtual address, which the caller
+ * releases with palloc_free_page(), or a null pointer if UPAGE is not
+ * mapped by a frame that can be shared. */
+void *
+pml4_share_page (uint64_t *pml4, const void *upage) {
+	ASSERT (pg_ofs (upage) == 0);
+	ASSERT (is_user_vaddr (upage));
+
+	uint64_t *pte = owned_pte (pml4, upage);
+	void *kpage;
+
+	if (pte == NULL || (*pte & PTE_NOSHARE))
+		return NULL;
+	kpage = ptov (PTE_ADDR (*pte));
+	if (!palloc_page_ref (kpage))
+		return NULL;
+	if (*pte & PTE_W) {
+		*pte = (*pte & ~PTE_W) | PTE_COW;
+		tlb_note_change (pml4, (uint64_t) upage);
+	}
+	return kpage;
+}
+
+/* Maps KPAGE, a user frame the caller holds a reference to, at user
+ * page UPAGE of PML4 in place of the writable frame there, which is
+ * freed.  The caller's reference passes to the new mapping, which is
+ * copy-on-write if KPAGE is still shared.  Returns false, changing
+ * nothing, if UPAGE is not mapped writable by a frame of its own. */
+bool
+pml4_replace_page (uint64_t *pml4, void *upage, void *kpage) {
+	ASSERT (pg_ofs (upage) == 0);
+	ASSERT (pg_ofs (kpage) == 0);
+	ASSERT (is_user_vaddr (upage));
+
+	uint64_t *pte = owned_pte (pml4, upage);
+	void *old;
+
+	if (pte == NULL || (*pte & PTE_NOSHARE) || !(*pte & (PTE_W | PTE_COW)))
+		return false;
+	old = ptov (PTE_ADDR (*pte));
+	*pte = vtop (kpage) | (*pte & PTE_FLAGS & ~(PTE_W | PTE_COW | PTE_D))
+		| (palloc_page_shared (kpage) ? PTE_COW : PTE_W);
+	tlb_note_change (pml4, (uint64_t) upage);
+	palloc_free_page (old);
+	return true;
+}
+
+/* Handles a store to VA, in user space, that faulted on a present
+ * page of PML4.  If the page is copy-on-write, makes it writable,
+ * copying the frame first if it is still shared, and returns true.
+ * Returns false if the fault is a real protection violation, or if
+ * memory for the copy is exhausted. */
+bool
+pml4_cow_fault (uint64_t *pml4, const void *va) {
+	void *upage = pg_round_down (va);
+	uint64_t *pte;
+
+	if (pml4 == NULL || !is_user_vaddr (va))
+		return false;
+	pte = owned_pte (pml4, upage);
+	if (pte == NULL || !(*pte & PTE_COW))
+		return false;
+
+	void *kpage = ptov (PTE_ADDR (*pte));
+	if (palloc_page_shared (kpage)) {
+		void *copy = palloc_get_page (PAL_USER);
+		if (copy == NULL)
+			return false;
+		memcpy (copy, kpage, PGSIZE);
+		*pte = vtop (copy) | (*pte & PTE_FLAGS);
+		palloc_free_page (kpage);
+	}
+	*pte = (*pte & ~PTE_COW) | PTE_W;
+	tlb_note_change (pml4, (uint64_t) upage);
+	return true;
+}
+
+/* Maps KPAGE, a user frame that belongs to shared memory, at user
+ * page UPAGE of PML4, which must not be mapped, taking a reference to
+ * the frame for the mapping.  Such a mapping (PTE_SHM) never becomes
+ * copy-on-write, and fork() gives the child the same frame instead of
+ * a copy.  Returns false if memory is exhausted. */
+bool
+pml4_set_shm_page (uint64_t *pml4, void *upage, void *kpage, bool rw) {
+	if (!palloc_page_ref (kpage))
+		return false;
+	if (!pml4_set_page (pml4, upage, kpage, rw)) {
+		palloc_free_page (kpage);
+		return false;
+	}
+	*pml4e_walk (pml4, (uint64_t) upage, 0) |= PTE_SHM;
+	return true;
+}
+
+/* Unmaps user page UPAGE of PML4 and drops the mapping's reference to
+ * its frame, if it was mapped with pml4_set_shm_page().  Returns false,
+ * changing nothing, otherwise. */
+bool
+pml4_clear_shm_page (uint64_t *pml4, void *upage) {
+	uint64_t *pte = owned_pte (pml4, upage);
+
+	if (pte == NULL || !(*pte & PTE_SHM))
+		return false;
+	*pte &= ~PTE_P;
+	tlb_note_change (pml4, (uint64_t) upage);
+	tlb_free_frame (pml4, ptov (PTE_ADDR (*pte)));
+	return true;
+}
+
+/* Unmaps user page UPAGE of PML4 and drops the mapping's reference to
+ * its frame, if UPAGE is mapped by an ordinary frame of its own, like
+ * the pages of a shrinking heap.  Returns false, changing nothing,
+ * otherwise. */
+bool
+pml4_release_page (uint64_t *pml4, void *upage) {
+	uint64_t *pte = owned_pte (pml4, upage);
+
+	if (pte == NULL || (*pte & PTE_NOSHARE))
+		return false;
+	*pte &= ~PTE_P;
+	tlb_note_change (pml4, (uint64_t) upage);
+	tlb_free_frame (pml4, ptov (PTE_ADDR (*pte)));
+	return true;
+}
+
+/* Marks user virtual page UPAGE "not present" in page
+ * directory PD.  Later accesses to the page will fault.  Other
+ * bits in the page table entry are preserved.
+ * UPAGE need not be mapped.  If UPAGE lies in a large page, the
+ * whole large page becomes not present. */
+void
+pml4_clear_page (uint64_t *pml4, void *upage) {
+	uint64_t *pte;
+	ASSERT (pg_ofs (upage) == 0);
+	ASSERT (is_user_vaddr (upage));
+
+	pte = pml4_lookup (pml4, (uint64_t) upage);
+
+	if (pte != NULL && (*pte & PTE_P) != 0) {
+		*pte &= ~PTE_P;
+		tlb_note_change (pml4, (uint64_t) upage);
+	}
+}
+
+/* Returns true if the PTE for virtual page VPAGE in PML4 is dirty,
+ * that is, if the page has been modified since the PTE was
+ * installed.
+ * Returns false if PML4 contains no PTE for VPAGE. */
+bool
+pml4_is_dirty (uint64_t *pml4, const void *vpage) {
+	uint64_t *pte = pml4_lookup (pml4, (uint64_t) vpage);
+	return pte != NULL && (*pte & PTE_D) != 0;
+}
+
+/* Set the dirty bit to DIRTY in the PTE for virtual page VPAGE
+ * in PML4. */
+void
+pml4_set_dirty (uint64_t *pml4, const void *vpage, bool dirty) {
+	uint64_t *pte = pml4_lookup (pml4, (uint64_t) vpage);
+	if (pte) {
+		if (dirty)
+			*pte |= PTE_D;
+		else
+			*pte &= ~(uint64_t) PTE_D;
+
+		tlb_note_change (pml4, (uint64_t) vpage);
+	}
+}
+
+/* Returns true if the PTE for virtual page VPAGE in PML4 has been
+ * accessed recently, that is, between the time the PTE was
+ * installed and the last time it was cleared.  Returns false if
+ * PML4 contains no PTE for VPAGE. */
+bool
+pml4_is_accessed (uint64_t *pml4, const void *vpage) {
+	uint64_t *pte = pml4_lookup (pml4, (uint64_t) vpage);
+	return pte != NULL && (*pte & PTE_A) != 0;
+}
+
+/* Sets the accessed bit to ACCESSED in the PTE for virtual page
+   VPAGE in PD. */
+void
+pml4_set_accessed (uint64_t *pml4, const void *vpage, bool accessed) {
+	uint64_t *pte = pml4_lookup (pml4, (uint64_t) vpage);
+	if (pte) {
+		if (accessed)
+			*pte |= PTE_A;
+		else
+			*pte &= ~(uint64_t) PTE_A;
+
+		tlb_note_change (pml4, (uint64_t) vpage);
+	}
+}
@@ -1,356 +1,430 @@
-#include "threads/palloc.h"
-#include <bitmap.h>
-#include <debug.h>
-#include <inttypes.h>
-#include <round.h>
-#include <stddef.h>
-#include <stdint.h>
-#include <stdio.h>
-#include <string.h>
-#include "threads/init.h"
-#include "threads/loader.h"
-#include "threads/synch.h"
-#include "threads/vaddr.h"
-
-/* Page allocator.  Hands out memory in page-size (or
-   page-multiple) chunks.  See malloc.h for an allocator that
-   hands out smaller chunks.
-
-   System memory is divided into two "pools" called the kernel
-   and user pools.  The user pool is for user (virtual) memory
-   pages, the kernel pool for everything else.  The idea here is
-   that the kernel needs to have memory for its own operations
-   even if user processes are swapping like mad.
-
-   By default, half of system RAM is given to the kernel pool and
-   half to the user pool.  That should be huge overkill for the
-   kernel pool, but that's just fine for demonstration purposes. */
-
-/* A memory pool. */
-struct pool {
-	struct lock lock;               /* Mutual exclusion. */
-	struct bitmap *used_map;        /* Bitmap of free pages. */
-	uint8_t *base;                  /* Base of pool. */
-};
-
-/* Two pools: one for kernel data, one for user pages. */
-static struct pool kernel_pool, user_pool;
-
-/* Maximum number of pages to put in user pool. */
-size_t user_page_limit = SIZE_MAX;
-static void
-init_pool (struct pool *p, void **bm_base, uint64_t start, uint64_t end);
-
-static bool page_from_pool (const struct pool *, void *page);
-
-/* multiboot info */
-struct multiboot_info {
-	uint32_t flags;
-	uint32_t mem_low;
-	uint32_t mem_high;
-	uint32_t __unused[8];
-	uint32_t mmap_len;
-	uint32_t mmap_base;
-};
-
-/* e820 entry */
-struct e820_entry {
-	uint32_t size;
-	uint32_t mem_lo;
-	uint32_t mem_hi;
-	uint32_t len_lo;
-	uint32_t len_hi;
-	uint32_t type;
-};
-
-/* Represent the range information of the ext_mem/base_mem */
-struct area {
-	uint64_t start;
-	uint64_t end;
-	uint64_t size;
-};
-
-#define BASE_MEM_THRESHOLD 0x100000
-#define USABLE 1
-#define ACPI_RECLAIMABLE 3
-#define APPEND_HILO(hi, lo) (((uint64_t) ((hi)) << 32) + (lo))
-
-/* Iterate on the e820 entry, parse the range of basemem and extmem. */
-static void
-resolve_area_info (struct area *base_mem, struct area *ext_mem) {
-	struct multiboot_info *mb_info = ptov (MULTIBOOT_INFO);
-	struct e820_entry *entries = ptov (mb_info->mmap_base);
-	uint32_t i;
-
-	for (i = 0; i < mb_info->mmap_len / sizeof (struct e820_entry); i++) {
-		struct e820_entry *entry = &entries[i];
-		if (entry->type == ACPI_RECLAIMABLE || entry->type == USABLE) {
-			uint64_t start = APPEND_HILO (entry->mem_hi, entry->mem_lo);
-			uint64_t size = APPEND_HILO (entry->len_hi, entry->len_lo);
-			uint64_t end = start + size;
-			printf("%llx ~ %llx %d\n", start, end, entry->type);
-
-			struct area *area = start < BASE_MEM_THRESHOLD ? base_mem : ext_mem;
-
-			// First entry that belong to this area.
-			if (area->size == 0) {
-				*area = (struct area) {
-					.start = start,
-					.end = end,
-					.size = size,
-				};
-			} else {  // otherwise
-				// Extend start
-				if (area->start > start)
-					area->start = start;
-				// Extend end
-				if (area->end < end)
-					area->end = end;
-				// Extend size
-				area->size += size;
-			}
-		}
-	}
-}
-
-/*
- * Populate the pool.
- * All the pages are manged by this allocator, even include code page.
- * Basically, give half of memory to kernel, half to user.
- * We push base_mem portion to the kernel as much as possible.
- */
-static void
-populate_pools (struct area *base_mem, struct area *ext_mem) {
-	extern char _end;
-	void *free_start = pg_round_up (&_end);
-
-	uint64_t total_pages = (base_mem->size + ext_mem->size) / PGSIZE;
-	uint64_t user_pages = total_pages / 2 > user_page_limit ?
-		user_page_limit : total_pages / 2;
-	uint64_t kern_pages = total_pages - user_pages;
-
-	// Parse E820 map to claim the memory region for each pool.
-	enum { KERN_START, KERN, USER_START, USER } state = KERN_START;
-	uint64_t rem = kern_pages;
-	uint64_t region_start = 0, end = 0, start, size, size_in_pg;
-
-	struct multiboot_info *mb_info = ptov (MULTIBOOT_INFO);
-	struct e820_entry *entries = ptov (mb_info->mmap_base);
-
-	uint32_t i;
-	for (i = 0; i < mb_info->mmap_len / sizeof (struct e820_entry); i++) {
-		struct e820_entry *entry = &entries[i];
-		if (entry->type == ACPI_RECLAIMABLE || entry->type == USABLE) {
-			start = (uint64_t) ptov (APPEND_HILO (entry->mem_hi, entry->mem_lo));
-			size = APPEND_HILO (entry->len_hi, entry->len_lo);
-			end = start + size;
-			size_in_pg = size / PGSIZE;
-
-			if (state == KERN_START) {
-				region_start = start;
-				state = KERN;
-			}
-
-			switch (state) {
-				case KERN:
-					if (rem > size_in_pg) {
-						rem -= size_in_pg;
-						break;
-					}
-					// generate kernel pool
-					init_pool (&kernel_pool,
-							&free_start, region_start, start + rem * PGSIZE);
-					// Transition to the next state
-					if (rem == size_in_pg) {
-						rem = user_pages;
-						state = USER_START;
-					} else {
-						region_start = start + rem * PGSIZE;
-						rem = user_pages - size_in_pg + rem;
-						state = USER;
-					}
-					break;
-				case USER_START:
-					region_start = start;
-					state = USER;
-					break;
-				case USER:
-					if (rem > size_in_pg) {
-						rem -= size_in_pg;
-						break;
-					}
-					ASSERT (rem == size);
-					break;
-				default:
-					NOT_REACHED ();
-			}
-		}
-	}
-
-	// generate the user pool
-	init_pool(&user_pool, &free_start, region_start, end);
-
-	// Iterate over the e820_entry. Setup the usable.
-	uint64_t usable_bound = (uint64_t) free_start;
-	struct pool *pool;
-	void *pool_end;
-	size_t page_idx, page_cnt;
-
-	for (i = 0; i < mb_info->mmap_len / sizeof (struct e820_entry); i++) {
-		struct e820_entry *entry = &entries[i];
-		if (entry->type == ACPI_RECLAIMABLE || entry->type == USABLE) {
-			uint64_t start = (uint64_t)
-				ptov (APPEND_HILO (entry->mem_hi, entry->mem_lo));
-			uint64_t size = APPEND_HILO (entry->len_hi, entry->len_lo);
-			uint64_t end = start + size;
-
-			// TODO: add 0x1000 ~ 0x200000, This is not a matter for now.
-			// All the pages are unuable
-			if (end < usable_bound)
-				continue;
-
-			start = (uint64_t)
-				pg_round_up (start >= usable_bound ? start : usable_bound);
-split:
-			if (page_from_pool (&kernel_pool, (void *) start))
-				pool = &kernel_pool;
-			else if (page_from_pool (&user_pool, (void *) start))
-				pool = &user_pool;
-			else
-				NOT_REACHED ();
-
-			pool_end = pool->base + bitmap_size (pool->used_map) * PGSIZE;
-			page_idx = pg_no (start) - pg_no (pool->base);
-			if ((uint64_t) pool_end < end) {
-				page_cnt = ((uint64_t) pool_end - start) / PGSIZE;
-				bitmap_set_multiple (pool->used_map, page_idx, page_cnt, false);
-				start = (uint64_t) pool_end;
-				goto split;
-			} else {
-				page_cnt = ((uint64_t) end - start) / PGSIZE;
-				bitmap_set_multiple (pool->used_map, page_idx, page_cnt, false);
-			}
-		}
-	}
-}
-
-/* Initializes the page allocator and get the memory size */
-uint64_t
-palloc_init (void) {
-  /* End of the kernel as recorded by the linker.
-     See kernel.lds.S. */
-	extern char _end;
-	struct area base_mem = { .size = 0 };
-	struct area ext_mem = { .size = 0 };
-
-	resolve_area_info (&base_mem, &ext_mem);
-	printf ("Pintos booting with: \n");
-	printf ("\tbase_mem: 0x%llx ~ 0x%llx (Usable: %'llu kB)\n",
-		  base_mem.start, base_mem.end, base_mem.size / 1024);
-	printf ("\text_mem: 0x%llx ~ 0x%llx (Usable: %'llu kB)\n",
-		  ext_mem.start, ext_mem.end, ext_mem.size / 1024);
-	populate_pools (&base_mem, &ext_mem);
-	return ext_mem.end;
-}
-
-/* PAGE_CNT개의 연속된 빈 페이지들을 확보하여 반환합니다.
-PAL_USER가 설정되어 있으면 사용자 풀(user pool)에서 페이지를 확보하고, 그렇지 않으면 커널 풀(kernel pool)에서 확보합니다.
-FLAGS에 PAL_ZERO가 설정되어 있으면, 해당 페이지들은 0으로 채워집니다.
-사용 가능한 페이지 수가 부족하면 null 포인터를 반환하지만, FLAGS에 PAL_ASSERT가 설정되어 있을 경우 커널 패닉이 발생합니다. */
-void *
-palloc_get_multiple (enum palloc_flags flags, size_t page_cnt) {
-	struct pool *pool = flags & PAL_USER ? &user_pool : &kernel_pool;
-
-	lock_acquire (&pool->lock);
-	size_t page_idx = bitmap_scan_and_flip (pool->used_map, 0, page_cnt, false);
-	lock_release (&pool->lock);
-	void *pages;
-
-	if (page_idx != BITMAP_ERROR)
-		pages = pool->base + PGSIZE * page_idx;
-	else
-		pages = NULL;
-
-	if (pages) {
-		if (flags & PAL_ZERO)
-			memset (pages, 0, PGSIZE * page_cnt);
-	} else {
-		if (flags & PAL_ASSERT)
-			PANIC ("palloc_get: out of pages");
-	}
-
-	return pages;
-}
-
-/* 하나의 사용 가능한 페이지를 확보하고 해당 페이지의 커널 가상 주소를 반환한다.
-   PAL_USER가 설정된 경우, 페이지는 유저 풀(user pool)에서 할당된다.
-   그렇지 않으면 커널 풀(kernel pool)에서 할당된다.
-   FLAGS에 PAL_ZERO가 설정되어 있으면, 페이지는 0으로 채워진다.
-   사용 가능한 페이지가 없을 경우:
-   		PAL_ASSERT가 FLAGS에 설정되어 있으면 널 포인터(NULL)를 반환한다.
-		PAL_ASSERT가 설정되어 있으면, kernel panic을 발생시키며 종료한다. */
-void *
-palloc_get_page (enum palloc_flags flags) {
-	return palloc_get_multiple (flags, 1);
-}
-
-/* Frees the PAGE_CNT pages starting at PAGES. */
-void
-palloc_free_multiple (void *pages, size_t page_cnt) {
-	struct pool *pool;
-	size_t page_idx;
-
-	ASSERT (pg_ofs (pages) == 0);
-	if (pages == NULL || page_cnt == 0)
-		return;
-
-	if (page_from_pool (&kernel_pool, pages))
-		pool = &kernel_pool;
-	else if (page_from_pool (&user_pool, pages))
-		pool = &user_pool;
-	else
-		NOT_REACHED ();
-
-	page_idx = pg_no (pages) - pg_no (pool->base);
-
-#ifndef NDEBUG
-	memset (pages, 0xcc, PGSIZE * page_cnt);
-#endif
-	ASSERT (bitmap_all (pool->used_map, page_idx, page_cnt));
-	bitmap_set_multiple (pool->used_map, page_idx, page_cnt, false);
-}
-
-/*  PAGE에서 페이지를 해제합니다. */
-void
-palloc_free_page (void *page) {
-	palloc_free_multiple (page, 1);
-}
-
-/* Initializes pool P as starting at START and ending at END */
-static void
-init_pool (struct pool *p, void **bm_base, uint64_t start, uint64_t end) {
-  /* We'll put the pool's used_map at its base.
-     Calculate the space needed for the bitmap
-     and subtract it from the pool's size. */
-	uint64_t pgcnt = (end - start) / PGSIZE;
-	size_t bm_pages = DIV_ROUND_UP (bitmap_buf_size (pgcnt), PGSIZE) * PGSIZE;
-
-	lock_init(&p->lock);
-	p->used_map = bitmap_create_in_buf (pgcnt, *bm_base, bm_pages);
-	p->base = (void *) start;
-
-	// Mark all to unusable.
-	bitmap_set_all(p->used_map, true);
-
-	*bm_base += bm_pages;
-}
-
-/* Returns true if PAGE was allocated from POOL,
-   false otherwise. */
-static bool
-page_from_pool (const struct pool *pool, void *page) {
-	size_t page_no = pg_no (page);
-	size_t start_page = pg_no (pool->base);
-	size_t end_page = start_page + bitmap_size (pool->used_map);
-	return page_no >= start_page && page_no < end_page;
-}
+#include "threads/palloc.h"
+#include <bitmap.h>
+#include <debug.h>
+#include <inttypes.h>
+#include <round.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "threads/init.h"
+#include "threads/interrupt.h"
+#include "threads/loader.h"
+#include "threads/synch.h"
+#include "threads/vaddr.h"
+
+/* Page allocator.  Hands out memory in page-size (or
+   page-multiple) chunks.  See malloc.h for an allocator that
+   hands out smaller chunks.
+
+   System memory is divided into two "pools" called the kernel
+   and user pools.  The user pool is for user (virtual) memory
+   pages, the kernel pool for everything else.  The idea here is
+   that the kernel needs to have memory for its own operations
+   even if user processes are swapping like mad.
+
+   By default, half of system RAM is given to the kernel pool and
+   half to the user pool.  That should be huge overkill for the
+   kernel pool, but that's just fine for demonstration purposes. */
+
+/* A memory pool. */
+struct pool {
+	struct lock lock;               /* Mutual exclusion. */
+	struct bitmap *used_map;        /* Bitmap of free pages. */
+	uint8_t *base;                  /* Base of pool. */
+	uint16_t *refs;                 /* Extra references, per page. */
+};
+
+/* Two pools: one for kernel data, one for user pages. */
+static struct pool kernel_pool, user_pool;
+
+/* Maximum number of pages to put in user pool. */
+size_t user_page_limit = SIZE_MAX;
+
+/* Called when a pool cannot satisfy a request; see
+   palloc_set_reclaim(). */
+static palloc_reclaim_func *reclaim_func;
+static void
+init_pool (struct pool *p, void **bm_base, uint64_t start, uint64_t end);
+
+static bool page_from_pool (const struct pool *, void *page);
+static size_t pool_scan_and_set (struct pool *, size_t page_cnt);
+
+/* multiboot info */
+struct multiboot_info {
+	uint32_t flags;
+	uint32_t mem_low;
+	uint32_t mem_high;
+	uint32_t __unused[8];
+	uint32_t mmap_len;
+	uint32_t mmap_base;
+};
+
+/* e820 entry */
+struct e820_entry {
+	uint32_t size;
+	uint32_t mem_lo;
+	uint32_t mem_hi;
+	uint32_t len_lo;
+	uint32_t len_hi;
+	uint32_t type;
+};
+
+/* Represent the range information of the ext_mem/base_mem */
+struct area {
+	uint64_t start;
+	uint64_t end;
+	uint64_t size;
+};
+
+#define BASE_MEM_THRESHOLD 0x100000
+#define USABLE 1
+#define ACPI_RECLAIMABLE 3
+#define APPEND_HILO(hi, lo) (((uint64_t) ((hi)) << 32) + (lo))
+
+/* Iterate on the e820 entry, parse the range of basemem and extmem. */
+static void
+resolve_area_info (struct area *base_mem, struct area *ext_mem) {
+	struct multiboot_info *mb_info = ptov (MULTIBOOT_INFO);
+	struct e820_entry *entries = ptov (mb_info->mmap_base);
+	uint32_t i;
+
+	for (i = 0; i < mb_info->mmap_len / sizeof (struct e820_entry); i++) {
+		struct e820_entry *entry = &entries[i];
+		if (entry->type == ACPI_RECLAIMABLE || entry->type == USABLE) {
+			uint64_t start = APPEND_HILO (entry->mem_hi, entry->mem_lo);
+			uint64_t size = APPEND_HILO (entry->len_hi, entry->len_lo);
+			uint64_t end = start + size;
+			printf("%llx ~ %llx %d\n", start, end, entry->type);
+
+			struct area *area = start < BASE_MEM_THRESHOLD ? base_mem : ext_mem;
+
+			// First entry that belong to this area.
+			if (area->size == 0) {
+				*area = (struct area) {
+					.start = start,
+					.end = end,
+					.size = size,
+				};
+			} else {  // otherwise
+				// Extend start
+				if (area->start > start)
+					area->start = start;
+				// Extend end
+				if (area->end < end)
+					area->end = end;
+				// Extend size
+				area->size += size;
+			}
+		}
+	}
+}
+
+/*
+ * Populate the pool.
+ * All the pages are manged by this allocator, even include code page.
+ * Basically, give half of memory to kernel, half to user.
+ * We push base_mem portion to the kernel as much as possible.
+ */
+static void
+populate_pools (struct area *base_mem, struct area *ext_mem) {
+	extern char _end;
+	void *free_start = pg_round_up (&_end);
+
+	uint64_t total_pages = (base_mem->size + ext_mem->size) / PGSIZE;
+	uint64_t user_pages = total_pages / 2 > user_page_limit ?
+		user_page_limit : total_pages / 2;
+	uint64_t kern_pages = total_pages - user_pages;
+
+	// Parse E820 map to claim the memory region for each pool.
+	enum { KERN_START, KERN, USER_START, USER } state = KERN_START;
+	uint64_t rem = kern_pages;
+	uint64_t region_start = 0, end = 0, start, size, size_in_pg;
+
+	struct multiboot_info *mb_info = ptov (MULTIBOOT_INFO);
+	struct e820_entry *entries = ptov (mb_info->mmap_base);
+
+	uint32_t i;
+	for (i = 0; i < mb_info->mmap_len / sizeof (struct e820_entry); i++) {
+		struct e820_entry *entry = &entries[i];
+		if (entry->type == ACPI_RECLAIMABLE || entry->type == USABLE) {
+			start = (uint64_t) ptov (APPEND_HILO (entry->mem_hi, entry->mem_lo));
+			size = APPEND_HILO (entry->len_hi, entry->len_lo);
+			end = start + size;
+			size_in_pg = size / PGSIZE;
+
+			if (state == KERN_START) {
+				region_start = start;
+				state = KERN;
+			}
+
+			switch (state) {
+				case KERN:
+					if (rem > size_in_pg) {
+						rem -= size_in_pg;
+						break;
+					}
+					// generate kernel pool
+					init_pool (&kernel_pool,
+							&free_start, region_start, start + rem * PGSIZE);
+					// Transition to the next state
+					if (rem == size_in_pg) {
+						rem = user_pages;
+						state = USER_START;
+					} else {
+						region_start = start + rem * PGSIZE;
+						rem = user_pages - size_in_pg + rem;
+						state = USER;
+					}
+					break;
+				case USER_START:
+					region_start = start;
+					state = USER;
+					break;
+				case USER:
+					if (rem > size_in_pg) {
+						rem -= size_in_pg;
+						break;
+					}
+					ASSERT (rem == size);
+					break;
+				default:
+					NOT_REACHED ();
+			}
+		}
+	}
+
+	// generate the user pool
+	init_pool(&user_pool, &free_start, region_start, end);
+
+	// User frames may be shared; see palloc_page_ref().
+	size_t refs_size = bitmap_size (user_pool.used_map) * sizeof (uint16_t);
+	user_pool.refs = free_start;
+	memset (user_pool.refs, 0, refs_size);
+	free_start += ROUND_UP (refs_size, PGSIZE);
+
+	// Iterate over the e820_entry. Setup the usable.
+	uint64_t usable_bound = (uint64_t) free_start;
+	struct pool *pool;
+	void *pool_end;
+	size_t page_idx, page_cnt;
+
+	for (i = 0; i < mb_info->mmap_len / sizeof (struct e820_entry); i++) {
+		struct e820_entry *entry = &entries[i];
+		if (entry->type == ACPI_RECLAIMABLE || entry->type == USABLE) {
+			uint64_t start = (uint64_t)
+				ptov (APPEND_HILO (entry->mem_hi, entry->mem_lo));
+			uint64_t size = APPEND_HILO (entry->len_hi, entry->len_lo);
+			uint64_t end = start + size;
+
+			// TODO: add 0x1000 ~ 0x200000, This is not a matter for now.
+			// All the pages are unuable
+			if (end < usable_bound)
+				continue;
+
+			start = (uint64_t)
+				pg_round_up (start >= usable_bound ? start : usable_bound);
+split:
+			if (page_from_pool (&kernel_pool, (void *) start))
+				pool = &kernel_pool;
+			else if (page_from_pool (&user_pool, (void *) start))
+				pool = &user_pool;
+			else
+				NOT_REACHED ();
+
+			pool_end = pool->base + bitmap_size (pool->used_map) * PGSIZE;
+			page_idx = pg_no (start) - pg_no (pool->base);
+			if ((uint64_t) pool_end < end) {
+				page_cnt = ((uint64_t) pool_end - start) / PGSIZE;
+				bitmap_set_multiple (pool->used_map, page_idx, page_cnt, false);
+				start = (uint64_t) pool_end;
+				goto split;
+			} else {
+				page_cnt = ((uint64_t) end - start) / PGSIZE;
+				bitmap_set_multiple (pool->used_map, page_idx, page_cnt, false);
+			}
+		}
+	}
+}
+
+/* Initializes the page allocator and get the memory size */
+uint64_t
+palloc_init (void) {
+  /* End of the kernel as recorded by the linker.
+     See kernel.lds.S. */
+	extern char _end;
+	struct area base_mem = { .size = 0 };
+	struct area ext_mem = { .size = 0 };
+
+	resolve_area_info (&base_mem, &ext_mem);
+	printf ("Pintos booting with: \n");
+	printf ("\tbase_mem: 0x%llx ~ 0x%llx (Usable: %'llu kB)\n",
+		  base_mem.start, base_mem.end, base_mem.size / 1024);
+	printf ("\text_mem: 0x%llx ~ 0x%llx (Usable: %'llu kB)\n",
+		  ext_mem.start, ext_mem.end, ext_mem.size / 1024);
+	populate_pools (&base_mem, &ext_mem);
+	return ext_mem.end;
+}
+
+/* PAGE_CNT개의 연속된 빈 페이지들을 확보하여 반환합니다.
+PAL_USER가 설정되어 있으면 사용자 풀(user pool)에서 페이지를 확보하고, 그렇지 않으면 커널 풀(kernel pool)에서 확보합니다.
+FLAGS에 PAL_ZERO가 설정되어 있으면, 해당 페이지들은 0으로 채워집니다.
+사용 가능한 페이지 수가 부족하면 null 포인터를 반환하지만, FLAGS에 PAL_ASSERT가 설정되어 있을 경우 커널 패닉이 발생합니다. */
+void *
+palloc_get_multiple (enum palloc_flags flags, size_t page_cnt) {
+	struct pool *pool = flags & PAL_USER ? &user_pool : &kernel_pool;
+
+	size_t page_idx = pool_scan_and_set (pool, page_cnt);
+	if (page_idx == BITMAP_ERROR && reclaim_func != NULL && reclaim_func ())
+		page_idx = pool_scan_and_set (pool, page_cnt);
+	void *pages;
+
+	if (page_idx != BITMAP_ERROR)
+		pages = pool->base + PGSIZE * page_idx;
+	else
+		pages = NULL;
+
+	if (pages) {
+		if (flags & PAL_ZERO)
+			memset (pages, 0, PGSIZE * page_cnt);
+	} else {
+		if (flags & PAL_ASSERT)
+			PANIC ("palloc_get: out of pages");
+	}
+
+	return pages;
+}
+
+/* 하나의 사용 가능한 페이지를 확보하고 해당 페이지의 커널 가상 주소를 반환한다.
+   PAL_USER가 설정된 경우, 페이지는 유저 풀(user pool)에서 할당된다.
+   그렇지 않으면 커널 풀(kernel pool)에서 할당된다.
+   FLAGS에 PAL_ZERO가 설정되어 있으면, 페이지는 0으로 채워진다.
+   사용 가능한 페이지가 없을 경우:
+   		PAL_ASSERT가 FLAGS에 설정되어 있으면 널 포인터(NULL)를 반환한다.
+		PAL_ASSERT가 설정되어 있으면, kernel panic을 발생시키며 종료한다. */
+void *
+palloc_get_page (enum palloc_flags flags) {
+	return palloc_get_multiple (flags, 1);
+}
+
+/* Frees the PAGE_CNT pages starting at PAGES. */
+void
+palloc_free_multiple (void *pages, size_t page_cnt) {
+	struct pool *pool;
+	size_t page_idx;
+
+	ASSERT (pg_ofs (pages) == 0);
+	if (pages == NULL || page_cnt == 0)
+		return;
+
+	if (page_from_pool (&kernel_pool, pages))
+		pool = &kernel_pool;
+	else if (page_from_pool (&user_pool, pages))
+		pool = &user_pool;
+	else
+		NOT_REACHED ();
+
+	page_idx = pg_no (pages) - pg_no (pool->base);
+
+	/* A shared frame only loses a reference. */
+	if (pool->refs != NULL && page_cnt == 1) {
+		enum intr_level old_level = intr_disable ();
+		bool shared = pool->refs[page_idx] > 0;
+		if (shared)
+			pool->refs[page_idx]--;
+		intr_set_level (old_level);
+		if (shared)
+			return;
+	}
+
+#ifndef NDEBUG
+	memset (pages, 0xcc, PGSIZE * page_cnt);
+#endif
+	ASSERT (bitmap_all (pool->used_map, page_idx, page_cnt));
+	bitmap_set_multiple (pool->used_map, page_idx, page_cnt, false);
+}
+
+/* Takes an extra reference to PAGE, a single page from the user
+   pool, so that it stays allocated until palloc_free_page() has been
+   called for it once more.  This lets one frame be mapped into
+   several address spaces, or queued in a pipe, at once.  Returns false
+   if PAGE is not from the user pool or has too many references. */
+bool
+palloc_page_ref (void *page) {
+	size_t page_idx;
+	bool ok;
+
+	if (!page_from_pool (&user_pool, page))
+		return false;
+	page_idx = pg_no (page) - pg_no (user_pool.base);
+
+	enum intr_level old_level = intr_disable ();
+	ok = user_pool.refs[page_idx] < UINT16_MAX;
+	if (ok)
+		user_pool.refs[page_idx]++;
+	intr_set_level (old_level);
+	return ok;
+}
+
+/* Returns true if user pool page PAGE has more than one reference,
+   that is, if freeing it now would not make it free. */
+bool
+palloc_page_shared (void *page) {
+	if (!page_from_pool (&user_pool, page))
+		return false;
+	return user_pool.refs[pg_no (page) - pg_no (user_pool.base)] > 0;
+}
+
+/* Registers FUNC to be called when an allocation finds its pool
+   exhausted.  FUNC should free whatever pages it can spare without
+   blocking on locks the caller may hold, and return true if it may
+   have freed some, in which case the allocation is retried once. */
+void
+palloc_set_reclaim (palloc_reclaim_func *func) {
+	reclaim_func = func;
+}
+
+/*  PAGE에서 페이지를 해제합니다. */
+void
+palloc_free_page (void *page) {
+	palloc_free_multiple (page, 1);
+}
+
+/* Initializes pool P as starting at START and ending at END */
+static void
+init_pool (struct pool *p, void **bm_base, uint64_t start, uint64_t end) {
+  /* We'll put the pool's used_map at its base.
+     Calculate the space needed for the bitmap
+     and subtract it from the pool's size. */
+	uint64_t pgcnt = (end - start) / PGSIZE;
+	size_t bm_pages = DIV_ROUND_UP (bitmap_buf_size (pgcnt), PGSIZE) * PGSIZE;
+
+	lock_init(&p->lock);
+	p->used_map = bitmap_create_in_buf (pgcnt, *bm_base, bm_pages);
+	p->base = (void *) start;
+
+	// Mark all to unusable.
+	bitmap_set_all(p->used_map, true);
+
+	*bm_base += bm_pages;
+}
+
+/* Finds PAGE_CNT free pages in POOL, marks them used and returns the
+   index of the first one, or BITMAP_ERROR if there is no such run. */
+static size_t
+pool_scan_and_set (struct pool *pool, size_t page_cnt) {
+	lock_acquire (&pool->lock);
+	size_t page_idx = bitmap_scan_and_flip (pool->used_map, 0, page_cnt, false);
+	lock_release (&pool->lock);
+	return page_idx;
+}
+
+/* Returns true if PAGE was allocated from POOL,
+   false otherwise. */
+static bool
+page_from_pool (const struct pool *pool, void *page) {
+	size_t page_no = pg_no (page);
+	size_t start_page = pg_no (pool->base);
+	size_t end_page = start_page + bitmap_size (pool->used_map);
+	return page_no >= start_page && page_no < end_page;
+}
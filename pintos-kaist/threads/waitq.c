@@ -0,0 +1,125 @@
+#include "threads/waitq.h"
+#include <debug.h>
+#include "devices/timer.h"
+#include "threads/interrupt.h"
+#include "threads/thread.h"
+
+static void wake (struct poller *);
+
+/* Initializes Q with no pollers. */
+void
+waitq_init (struct waitq *q) {
+	list_init (&q->entries);
+}
+
+/* Wakes up every poller hooked onto Q. */
+void
+waitq_wake (struct waitq *q) {
+	enum intr_level old_level = intr_disable ();
+	struct list_elem *e;
+
+	for (e = list_begin (&q->entries); e != list_end (&q->entries);
+			e = list_next (e))
+		wake (list_entry (e, struct waitq_entry, elem)->poller);
+	intr_set_level (old_level);
+}
+
+/* Makes P a poller for the current thread, hooked onto nothing. */
+void
+poller_init (struct poller *p) {
+	p->thread = thread_current ();
+	p->woken = false;
+	p->sleeping = false;
+	p->timed = false;
+}
+
+/* Hooks P onto Q through E, which must stay put until
+ * poller_remove(). */
+void
+poller_add (struct poller *p, struct waitq *q, struct waitq_entry *e) {
+	enum intr_level old_level = intr_disable ();
+
+	e->poller = p;
+	list_push_back (&q->entries, &e->elem);
+	intr_set_level (old_level);
+}
+
+/* Unhooks E, if poller_add() hooked it.  E's POLLER must be null if
+ * it never was. */
+void
+poller_remove (struct waitq_entry *e) {
+	enum intr_level old_level;
+
+	if (e->poller == NULL)
+		return;
+	old_level = intr_disable ();
+	list_remove (&e->elem);
+	e->poller = NULL;
+	intr_set_level (old_level);
+}
+
+/* Sleeps until a waitq that P is hooked onto is woken, or until timer
+ * tick DEADLINE if it is not negative, unless one was woken already
+ * since the last call.  Returns true if woken, false on timeout. */
+bool
+poller_wait (struct poller *p, int64_t deadline) {
+	enum intr_level old_level;
+	bool woken;
+
+	ASSERT (p->thread == thread_current ());
+	ASSERT (!intr_context ());
+
+	old_level = intr_disable ();
+	p->thread->poller = p;
+	while (!p->woken && !p->thread->interrupted
+			&& (deadline < 0 || timer_ticks () < deadline)) {
+		p->sleeping = true;
+		p->timed = deadline >= 0;
+		if (p->timed)
+			thread_sleep (deadline);
+		else
+			thread_block ();
+		p->sleeping = false;
+	}
+	p->thread->poller = NULL;
+	woken = p->woken || p->thread->interrupted;
+	p->woken = false;
+	intr_set_level (old_level);
+	return woken;
+}
+
+/* Wakes up T if it sleeps in poller_wait(), and makes its later
+ * poller_wait()s return at once. */
+void
+poller_interrupt (struct thread *t) {
+	enum intr_level old_level = intr_disable ();
+
+	t->interrupted = true;
+	if (t->poller != NULL)
+		wake (t->poller);
+	intr_set_level (old_level);
+}
+
+/* Returns true if P's thread has been interrupted. */
+bool
+poller_interrupted (const struct poller *p) {
+	return p->thread->interrupted;
+}
+
+/* Marks P woken, and wakes its thread up if it sleeps.  Interrupts
+ * must be off. */
+static void
+wake (struct poller *p) {
+	ASSERT (intr_get_level () == INTR_OFF);
+
+	p->woken = true;
+	/* A poller the timer already woke is on the ready list, not
+	 * blocked, until it runs again. */
+	if (p->sleeping && p->thread->status == THREAD_BLOCKED) {
+		p->sleeping = false;
+		if (p->timed)
+			thread_wake_early (p->thread);
+		else
+			thread_unblock (p->thread);
+	}
+}
@@ -0,0 +1,278 @@
+#include "userprog/exec_cache.h"
+#include <debug.h>
+#include "filesys/inode.h"
+#include "threads/malloc.h"
+#include "threads/palloc.h"
+#include "threads/synch.h"
+#include "threads/vaddr.h"
+
+/* Executable image cache.
+ *
+ * load() reads and validates an executable's ELF headers into an
+ * exec_image, which it files here under the executable's inode, so
+ * that the next load() of the same inode can skip the headers.  An
+ * image holds its inode open: that keeps the inode, and so the write
+ * generation the image was read at, from going away.  Images whose
+ * inode has been written or removed since are dropped on the next
+ * lookup.
+ *
+ * Without VM, an image also holds a reference to each page of its
+ * read-only segments that some load() has read, and later loads map
+ * that frame read-only instead of reading the page again.  Those
+ * pages are what exec_cache_reclaim() gives back when memory runs
+ * short.
+ *
+ * Images are reference counted: one reference while cached, and one
+ * for each load() using the image. */
+
+#define EXEC_CACHE_MAX 16           /* Most images cached. */
+
+static struct list cache;           /* Cached images, most recent first. */
+static size_t cache_cnt;            /* Number of images in CACHE. */
+static struct lock cache_lock;      /* Protects the above and images. */
+
+static bool image_stale (const struct exec_image *);
+static void image_free (struct exec_image *);
+static bool image_drop_pages (struct exec_image *);
+
+/* Initializes the executable image cache. */
+void
+exec_cache_init (void) {
+	list_init (&cache);
+	lock_init (&cache_lock);
+}
+
+/* Returns a new, uncached image of executable INODE with entry point
+ * ENTRY and room for SEG_MAX segments, holding one reference for the
+ * caller, or a null pointer if memory is exhausted. */
+struct exec_image *
+exec_image_create (struct inode *inode, uint64_t entry, int seg_max) {
+	struct exec_image *img = malloc (sizeof *img);
+	if (img == NULL)
+		return NULL;
+	img->segs = NULL;
+	if (seg_max > 0
+			&& (img->segs = calloc (seg_max, sizeof *img->segs)) == NULL) {
+		free (img);
+		return NULL;
+	}
+	img->inode = inode_reopen (inode);
+	img->gen = inode_write_gen (inode);
+	img->users = 1;
+	img->cached = false;
+	img->entry = entry;
+	img->seg_cnt = 0;
+	img->seg_max = seg_max;
+	return img;
+}
+
+/* Appends a segment to IMG, which must not be cached yet.  Returns
+ * false if memory is exhausted. */
+bool
+exec_image_add (struct exec_image *img, off_t ofs, void *upage,
+		uint32_t read_bytes, uint32_t zero_bytes, bool writable) {
+	struct exec_segment *s;
+
+	ASSERT (!img->cached);
+	ASSERT (img->seg_cnt < img->seg_max);
+	ASSERT ((read_bytes + zero_bytes) % PGSIZE == 0);
+
+	s = &img->segs[img->seg_cnt];
+	s->ofs = ofs;
+	s->upage = upage;
+	s->read_bytes = read_bytes;
+	s->zero_bytes = zero_bytes;
+	s->writable = writable;
+	s->pages = NULL;
+#ifndef VM
+	if (!writable) {
+		s->pages = calloc ((read_bytes + zero_bytes) / PGSIZE,
+				sizeof *s->pages);
+		if (s->pages == NULL)
+			return false;
+	}
+#endif
+	img->seg_cnt++;
+	return true;
+}
+
+/* Looks up the cached image of executable INODE.  Returns it with a
+ * reference for the caller, or a null pointer if there is no image or
+ * it is out of date.  Drops every out-of-date image on the way. */
+struct exec_image *
+exec_cache_get (struct inode *inode) {
+	struct exec_image *found = NULL;
+	struct list stale;
+	struct list_elem *e;
+
+	list_init (&stale);
+	lock_acquire (&cache_lock);
+	for (e = list_begin (&cache); e != list_end (&cache);) {
+		struct exec_image *img = list_entry (e, struct exec_image, elem);
+		e = list_next (e);
+		if (image_stale (img)) {
+			list_remove (&img->elem);
+			cache_cnt--;
+			img->cached = false;
+			if (--img->users == 0)
+				list_push_back (&stale, &img->elem);
+		} else if (img->inode == inode && found == NULL) {
+			found = img;
+			found->users++;
+			list_remove (&img->elem);
+			list_push_front (&cache, &img->elem);
+		}
+	}
+	lock_release (&cache_lock);
+
+	/* Closing the inodes may free their blocks. */
+	while (!list_empty (&stale))
+		image_free (list_entry (list_pop_front (&stale),
+					struct exec_image, elem));
+	return found;
+}
+
+/* Adds IMG, to which the caller holds a reference, to the cache,
+ * unless an up-to-date image of the same inode is already there.
+ * Evicts the least recently used image if the cache is full. */
+void
+exec_cache_insert (struct exec_image *img) {
+	struct exec_image *victim = NULL;
+	struct list_elem *e;
+
+	lock_acquire (&cache_lock);
+	ASSERT (!img->cached);
+	for (e = list_begin (&cache); e != list_end (&cache); e = list_next (e)) {
+		struct exec_image *other = list_entry (e, struct exec_image, elem);
+		if (other->inode == img->inode && other->gen == img->gen) {
+			/* A concurrent load() got there first. */
+			lock_release (&cache_lock);
+			return;
+		}
+	}
+	img->users++;
+	img->cached = true;
+	list_push_front (&cache, &img->elem);
+	if (++cache_cnt > EXEC_CACHE_MAX) {
+		victim = list_entry (list_pop_back (&cache), struct exec_image, elem);
+		cache_cnt--;
+		victim->cached = false;
+		if (--victim->users > 0)
+			victim = NULL;
+	}
+	lock_release (&cache_lock);
+
+	if (victim != NULL)
+		image_free (victim);
+}
+
+/* Drops a reference to IMG, freeing it with the last one. */
+void
+exec_cache_put (struct exec_image *img) {
+	bool last;
+
+	lock_acquire (&cache_lock);
+	last = --img->users == 0;
+	lock_release (&cache_lock);
+
+	if (last)
+		image_free (img);
+}
+
+/* Returns the resident frame holding page IDX of IMG's segment SEG,
+ * with a new reference for the caller, or a null pointer if the
+ * segment keeps no pages or that one has not been read yet. */
+void *
+exec_image_page (struct exec_image *img, int seg, size_t idx) {
+	void **pages = img->segs[seg].pages;
+	void *kpage = NULL;
+
+	if (pages == NULL)
+		return NULL;
+	lock_acquire (&cache_lock);
+	if (pages[idx] != NULL && palloc_page_ref (pages[idx]))
+		kpage = pages[idx];
+	lock_release (&cache_lock);
+	return kpage;
+}
+
+/* Offers frame KPAGE, freshly read as page IDX of IMG's segment SEG,
+ * for later loads of IMG to share.  IMG takes a reference of its own
+ * if it keeps the page. */
+void
+exec_image_keep_page (struct exec_image *img, int seg, size_t idx,
+		void *kpage) {
+	void **pages = img->segs[seg].pages;
+
+	if (pages == NULL)
+		return;
+	lock_acquire (&cache_lock);
+	if (pages[idx] == NULL && palloc_page_ref (kpage))
+		pages[idx] = kpage;
+	lock_release (&cache_lock);
+}
+
+/* Drops the resident pages of the least recently used cached image
+ * that no load() is using.  Returns true if that released any pages.
+ * Called from palloc's reclaim hook, so it never waits for the cache
+ * lock. */
+bool
+exec_cache_reclaim (void) {
+	struct list_elem *e;
+	bool freed = false;
+
+	if (!lock_try_acquire (&cache_lock))
+		return false;
+	for (e = list_rbegin (&cache); !freed && e != list_rend (&cache);
+			e = list_prev (e)) {
+		struct exec_image *img = list_entry (e, struct exec_image, elem);
+		if (img->users == 1)
+			freed = image_drop_pages (img);
+	}
+	lock_release (&cache_lock);
+	return freed;
+}
+
+/* Returns true if IMG's inode has been written or removed since IMG
+ * was read. */
+static bool
+image_stale (const struct exec_image *img) {
+	return inode_write_gen (img->inode) != img->gen;
+}
+
+/* Frees IMG, which nothing references anymore. */
+static void
+image_free (struct exec_image *img) {
+	int i;
+
+	ASSERT (img->users == 0);
+	image_drop_pages (img);
+	for (i = 0; i < img->seg_cnt; i++)
+		free (img->segs[i].pages);
+	free (img->segs);
+	inode_close (img->inode);
+	free (img);
+}
+
+/* Drops IMG's references to its resident pages.  Returns true if it
+ * had any. */
+static bool
+image_drop_pages (struct exec_image *img) {
+	bool dropped = false;
+	int i;
+
+	for (i = 0; i < img->seg_cnt; i++) {
+		struct exec_segment *s = &img->segs[i];
+		size_t j;
+
+		if (s->pages == NULL)
+			continue;
+		for (j = 0; j < (s->read_bytes + s->zero_bytes) / PGSIZE; j++)
+			if (s->pages[j] != NULL) {
+				palloc_free_page (s->pages[j]);
+				s->pages[j] = NULL;
+				dropped = true;
+			}
+	}
+	return dropped;
+}
@@ -0,0 +1,448 @@
+#include "userprog/fd.h"
+#include <debug.h>
+#include <stddef.h>
+#include <string.h>
+#include "filesys/file.h"
+#include "threads/malloc.h"
+#include "userprog/pipe.h"
+#include "userprog/shm.h"
+#include "userprog/stdout.h"
+#include "userprog/syscall.h"
+
+/* File descriptor tables.
+ *
+ * Slot FD of a table points to the open file description behind
+ * descriptor FD, and bit FD of the USED bitmap says whether the slot
+ * is in use.  The lowest free descriptor is found with one ctz per
+ * bitmap word, and fork and exit visit only the open descriptors the
+ * same way, instead of every slot.  A table starts with one word's
+ * worth of slots and doubles when open() or dup2() needs more.
+ *
+ * A table belongs to a single process, which is also the only user of
+ * the descriptions in it, but the threads of the process share it
+ * (userprog/uthread.c).  The table's lock covers its slots and the
+ * reference counts of its descriptions.  A system call holds a
+ * reference to the description it works on, from fd_get() to
+ * fd_put(), so that a close() by another thread meanwhile only drops
+ * the descriptor, and the last of the two to let go closes the file.
+ * Callers that may close the last reference to a file hold
+ * filesys_lock, as for any other file_close(), except that fd_put()
+ * takes it itself.
+ *
+ * Console output descriptions buffer what they write
+ * (userprog/stdout.c).  A forked copy starts with its own empty
+ * buffer, after the parent's has been flushed. */
+
+#define FD_INIT_CAP 64
+
+static bool fd_table_grow (struct fd_table *, int min_cap);
+static int lowest_free (const struct fd_table *);
+static int next_open (const struct fd_table *, int fd);
+static int fd_alloc_desc (struct fd_table *, enum fdesc_kind,
+		struct file *, struct pipe *, struct shm *);
+static struct fdesc *fd_lookup (struct fd_table *, int fd);
+static void fd_set (struct fd_table *, int fd, struct fdesc *);
+static void fd_clear (struct fd_table *, int fd);
+static void fdesc_free (struct fdesc *);
+
+/* Returns a new table with the console at fd 0 (input) and fd 1
+ * (output), or a null pointer if memory is exhausted. */
+struct fd_table *
+fd_table_create (void) {
+	struct fd_table *t = calloc (1, sizeof *t);
+	if (t == NULL)
+		return NULL;
+	lock_init (&t->lock);
+	if (!fd_table_grow (t, FD_INIT_CAP)
+			|| fd_alloc (t, FD_STDIN, NULL) != 0
+			|| fd_alloc (t, FD_STDOUT, NULL) != 1) {
+		fd_table_destroy (t);
+		return NULL;
+	}
+	return t;
+}
+
+/* Returns a copy of PARENT for a child process, or a null pointer if
+ * memory is exhausted.  Each file gets its own file_duplicate() in the
+ * child, but descriptors that share a description in PARENT share the
+ * copy in the child too. */
+struct fd_table *
+fd_table_fork (struct fd_table *parent) {
+	struct fd_table *child = calloc (1, sizeof *child);
+	int fd;
+
+	if (child == NULL)
+		return NULL;
+	lock_init (&child->lock);
+
+	/* Output the parent buffered before fork() comes out once, ahead
+	 * of the child's.  Flushing may sleep, so not under the lock. */
+	fd_flush (parent);
+
+	/* Other threads of the parent's process may use PARENT meanwhile. */
+	lock_acquire (&parent->lock);
+	if (!fd_table_grow (child, parent->cap))
+		goto error;
+
+	for (fd = next_open (parent, 0); fd >= 0; fd = next_open (parent, fd + 1))
+		parent->slots[fd]->fork_copy = NULL;
+	for (fd = next_open (parent, 0); fd >= 0; fd = next_open (parent, fd + 1)) {
+		struct fdesc *d = parent->slots[fd];
+		if (d->fork_copy == NULL) {
+			struct fdesc *copy = malloc (sizeof *copy);
+			if (copy == NULL)
+				goto error;
+			copy->refcnt = 0;
+			copy->kind = d->kind;
+			copy->flags = d->flags;
+			copy->file = NULL;
+			copy->pipe = d->pipe;
+			copy->shm = d->shm;
+			copy->out = NULL;
+			if (d->kind == FD_FILE
+					&& (copy->file = file_duplicate (d->file)) == NULL) {
+				free (copy);
+				goto error;
+			}
+			if (d->pipe != NULL)
+				pipe_open (d->pipe, d->kind == FD_PIPE_WRITE);
+			if (d->shm != NULL)
+				shm_ref (d->shm);
+			if (d->out != NULL)
+				copy->out = stdout_create ();
+			d->fork_copy = copy;
+		}
+		fd_set (child, fd, d->fork_copy);
+	}
+	lock_release (&parent->lock);
+	return child;
+
+error:
+	lock_release (&parent->lock);
+	lock_acquire (&filesys_lock);
+	fd_table_destroy (child);
+	lock_release (&filesys_lock);
+	return NULL;
+}
+
+/* Closes every descriptor in T, which no other thread uses anymore,
+ * and frees T.  T may be null. */
+void
+fd_table_destroy (struct fd_table *t) {
+	if (t == NULL)
+		return;
+	for (int fd = next_open (t, 0); fd >= 0; fd = next_open (t, fd + 1))
+		if (--t->slots[fd]->refcnt == 0)
+			fdesc_free (t->slots[fd]);
+	free (t->slots);
+	free (t->used);
+	free (t);
+}
+
+/* Installs a new description of KIND for FILE (FD_FILE only) at the
+ * lowest free descriptor of T and returns it.  Returns -1 if T is full
+ * or memory is exhausted, in which case FILE is left open. */
+int
+fd_alloc (struct fd_table *t, enum fdesc_kind kind, struct file *file) {
+	return fd_alloc_desc (t, kind, file, NULL, NULL);
+}
+
+/* Like fd_alloc(), but for the end of pipe P that KIND names.  The
+ * new descriptor takes over the caller's reference to that end; on
+ * failure the caller keeps it. */
+int
+fd_alloc_pipe (struct fd_table *t, enum fdesc_kind kind, struct pipe *p) {
+	ASSERT (kind == FD_PIPE_READ || kind == FD_PIPE_WRITE);
+	return fd_alloc_desc (t, kind, NULL, p, NULL);
+}
+
+/* Like fd_alloc(), but for shared memory object SHM.  The new
+ * descriptor takes over the caller's reference to SHM; on failure the
+ * caller keeps it. */
+int
+fd_alloc_shm (struct fd_table *t, struct shm *shm) {
+	return fd_alloc_desc (t, FD_SHM, NULL, NULL, shm);
+}
+
+/* Returns the description behind FD in T, with a reference for the
+ * caller to drop with fd_put(), or a null pointer if FD is not open.
+ * T may be null. */
+struct fdesc *
+fd_get (struct fd_table *t, int fd) {
+	struct fdesc *d;
+
+	if (t == NULL)
+		return NULL;
+	lock_acquire (&t->lock);
+	d = fd_lookup (t, fd);
+	if (d != NULL)
+		d->refcnt++;
+	lock_release (&t->lock);
+	return d;
+}
+
+/* Drops the reference to D, from T, that fd_get() returned.  If its
+ * descriptors have all been closed meanwhile, closes D's file, taking
+ * filesys_lock, which the caller must not hold. */
+void
+fd_put (struct fd_table *t, struct fdesc *d) {
+	bool last;
+
+	lock_acquire (&t->lock);
+	last = --d->refcnt == 0;
+	lock_release (&t->lock);
+
+	if (last) {
+		lock_acquire (&filesys_lock);
+		fdesc_free (d);
+		lock_release (&filesys_lock);
+	}
+}
+
+/* Closes FD in T.  Returns false if FD was not open. */
+bool
+fd_close (struct fd_table *t, int fd) {
+	struct fdesc *d;
+	bool last;
+
+	lock_acquire (&t->lock);
+	d = fd_lookup (t, fd);
+	if (d == NULL) {
+		lock_release (&t->lock);
+		return false;
+	}
+	fd_clear (t, fd);
+	last = --d->refcnt == 0;
+	lock_release (&t->lock);
+
+	if (last)
+		fdesc_free (d);
+	return true;
+}
+
+/* Makes NEWFD of T refer to the description behind OLDFD, closing
+ * NEWFD first if it is open.  Returns NEWFD, or -1 if OLDFD is not
+ * open or NEWFD is out of range. */
+int
+fd_dup2 (struct fd_table *t, int oldfd, int newfd) {
+	struct fdesc *d, *old = NULL;
+
+	if (newfd < 0 || newfd >= FD_MAX)
+		return -1;
+	lock_acquire (&t->lock);
+	d = fd_lookup (t, oldfd);
+	if (d == NULL || (newfd >= t->cap && !fd_table_grow (t, newfd + 1))) {
+		lock_release (&t->lock);
+		return -1;
+	}
+	if (oldfd != newfd) {
+		old = fd_lookup (t, newfd);
+		if (old != NULL) {
+			fd_clear (t, newfd);
+			if (--old->refcnt > 0)
+				old = NULL;
+		}
+		fd_set (t, newfd, d);
+	}
+	lock_release (&t->lock);
+
+	if (old != NULL)
+		fdesc_free (old);
+	return newfd;
+}
+
+/* Writes out whatever the console output descriptions of T hold.  T
+ * may be null.  Each description is flushed through a reference taken
+ * as fd_get() does, without T's lock, since writing to the console
+ * may sleep; the caller must not hold filesys_lock, as for
+ * fd_put(). */
+void
+fd_flush (struct fd_table *t) {
+	int fd = 0;
+
+	if (t == NULL)
+		return;
+	for (;;) {
+		struct fdesc *d = NULL;
+
+		lock_acquire (&t->lock);
+		for (fd = next_open (t, fd); fd >= 0; fd = next_open (t, fd + 1))
+			if (t->slots[fd]->out != NULL) {
+				d = t->slots[fd];
+				d->refcnt++;
+				break;
+			}
+		lock_release (&t->lock);
+		if (d == NULL)
+			break;
+
+		stdout_flush (d->out);
+		fd_put (t, d);
+		fd++;
+	}
+}
+
+/* Closes every pipe end open in T, so that the other ends see end of
+ * file or a broken pipe now rather than when T is destroyed.  T may
+ * be null.  Closing a pipe end needs no filesys_lock. */
+void
+fd_close_pipes (struct fd_table *t) {
+	int fd = 0;
+
+	if (t == NULL)
+		return;
+	for (;;) {
+		struct fdesc *d = NULL;
+		bool last;
+
+		lock_acquire (&t->lock);
+		for (fd = next_open (t, fd); fd >= 0; fd = next_open (t, fd + 1))
+			if (t->slots[fd]->kind == FD_PIPE_READ
+					|| t->slots[fd]->kind == FD_PIPE_WRITE) {
+				d = t->slots[fd];
+				break;
+			}
+		if (d == NULL) {
+			lock_release (&t->lock);
+			break;
+		}
+		fd_clear (t, fd);
+		last = --d->refcnt == 0;
+		lock_release (&t->lock);
+
+		if (last)
+			fdesc_free (d);
+		fd++;
+	}
+}
+
+/* Installs a new description of KIND, referring to FILE, P or SHM as
+ * KIND says, at the lowest free descriptor of T and returns it.
+ * Returns -1 if T is full or memory is exhausted, in which case the
+ * caller keeps FILE, P or SHM. */
+static int
+fd_alloc_desc (struct fd_table *t, enum fdesc_kind kind, struct file *file,
+		struct pipe *p, struct shm *shm) {
+	struct fdesc *d = malloc (sizeof *d);
+	int fd;
+
+	if (d == NULL)
+		return -1;
+	d->refcnt = 0;
+	d->kind = kind;
+	d->flags = 0;
+	d->file = file;
+	d->pipe = p;
+	d->shm = shm;
+	d->out = kind == FD_STDOUT ? stdout_create () : NULL;
+
+	lock_acquire (&t->lock);
+	fd = lowest_free (t);
+	if (fd >= t->cap && !fd_table_grow (t, fd + 1))
+		fd = -1;
+	else
+		fd_set (t, fd, d);
+	lock_release (&t->lock);
+
+	if (fd < 0) {
+		stdout_destroy (d->out);
+		free (d);
+	}
+	return fd;
+}
+
+/* Enlarges T to at least MIN_CAP slots, doubling its size.  Returns
+ * false if that would exceed FD_MAX or memory is exhausted. */
+static bool
+fd_table_grow (struct fd_table *t, int min_cap) {
+	int cap = t->cap != 0 ? t->cap : FD_INIT_CAP;
+	struct fdesc **slots;
+	uint64_t *used;
+
+	while (cap < min_cap)
+		cap *= 2;
+	if (cap > FD_MAX)
+		return false;
+	if (cap == t->cap)
+		return true;
+
+	slots = realloc (t->slots, cap * sizeof *slots);
+	if (slots == NULL)
+		return false;
+	t->slots = slots;
+	used = realloc (t->used, cap / 64 * sizeof *used);
+	if (used == NULL)
+		return false;
+	t->used = used;
+
+	memset (slots + t->cap, 0, (cap - t->cap) * sizeof *slots);
+	memset (used + t->cap / 64, 0, (cap - t->cap) / 64 * sizeof *used);
+	t->cap = cap;
+	return true;
+}
+
+/* Returns the lowest free descriptor of T, which is T->cap if every
+ * slot is in use. */
+static int
+lowest_free (const struct fd_table *t) {
+	for (int w = 0; w < t->cap / 64; w++)
+		if (~t->used[w] != 0)
+			return w * 64 + __builtin_ctzll (~t->used[w]);
+	return t->cap;
+}
+
+/* Returns the lowest open descriptor of T that is at least FD, or -1
+ * if there is none. */
+static int
+next_open (const struct fd_table *t, int fd) {
+	for (int w = fd / 64; w < t->cap / 64; w++) {
+		uint64_t bits = t->used[w];
+		if (w == fd / 64)
+			bits &= ~0ULL << (fd % 64);
+		if (bits != 0)
+			return w * 64 + __builtin_ctzll (bits);
+	}
+	return -1;
+}
+
+/* Returns the description behind FD in T, or a null pointer if FD is
+ * not open. */
+static struct fdesc *
+fd_lookup (struct fd_table *t, int fd) {
+	if (fd < 0 || fd >= t->cap)
+		return NULL;
+	return t->slots[fd];
+}
+
+/* Points free descriptor FD of T, which must be within T's
+ * capacity, at D. */
+static void
+fd_set (struct fd_table *t, int fd, struct fdesc *d) {
+	ASSERT (fd < t->cap && t->slots[fd] == NULL);
+	t->slots[fd] = d;
+	t->used[fd / 64] |= 1ULL << (fd % 64);
+	d->refcnt++;
+}
+
+/* Marks open descriptor FD of T free, leaving its description's
+ * reference count to the caller. */
+static void
+fd_clear (struct fd_table *t, int fd) {
+	t->slots[fd] = NULL;
+	t->used[fd / 64] &= ~(1ULL << (fd % 64));
+}
+
+/* Closes the file, pipe end or shared memory object of D, which
+ * nothing refers to anymore, and frees D. */
+static void
+fdesc_free (struct fdesc *d) {
+	ASSERT (d->refcnt == 0);
+	if (d->kind == FD_FILE)
+		file_close (d->file);
+	else if (d->pipe != NULL)
+		pipe_close (d->pipe, d->kind == FD_PIPE_WRITE);
+	else if (d->shm != NULL)
+		shm_close (d->shm);
+	stdout_destroy (d->out);
+	free (d);
+}
@@ -0,0 +1,418 @@
+#include "userprog/futex.h"
+#include <debug.h>
+#include <hash.h>
+#include <list.h>
+#include "threads/malloc.h"
+#include "threads/mmu.h"
+#include "threads/palloc.h"
+#include "threads/pte.h"
+#include "threads/synch.h"
+#include "threads/vaddr.h"
+#include "user/syscall.h"
+#include "userprog/syscall.h"
+#include "userprog/uaccess.h"
+#include "userprog/uthread.h"
+
+/* Futexes.
+ *
+ * A futex is an int in user memory that user code locks and unlocks
+ * with atomic instructions of its own, calling into the kernel only
+ * to sleep while it is contended and to wake up sleepers.  Sleepers
+ * wait in a queue filed under the physical address of the word, so
+ * that threads and processes that map the same frame, through shared
+ * memory or a thread group, find the same queue wherever they map it.
+ * A queue exists only while some thread is inside a futex call on
+ * its word, and each such thread holds a reference to the word's
+ * frame, so the address cannot be reused meanwhile.
+ *
+ * FUTEX_WAIT and FUTEX_WAKE leave the meaning of the word to user
+ * code.  FUTEX_LOCK_PI and FUTEX_UNLOCK_PI define it: the owner's
+ * thread id, or 0 if unlocked, with FUTEX_WAITERS set while others
+ * wait.  The kernel mirrors a contended PI futex with a kernel lock,
+ * which it makes the owner hold, so that waiting for it donates
+ * priority to the owner exactly as waiting for any lock does.  When
+ * the owner exits holding it, the lock passes to the next waiter.
+ *
+ * Waits are never cut short, except that exit() in one thread of a
+ * process wakes the others from FUTEX_WAIT, so that they can exit
+ * too.  Waiters should always recheck the word after waking. */
+
+/* Sleepers on one futex word. */
+struct futex_queue {
+	struct hash_elem elem;          /* Element in queues. */
+	uint64_t key;                   /* Physical address of the word. */
+	int users;                      /* Threads using the queue. */
+	struct list waiters;            /* futex_waiters, by priority. */
+	struct lock pi;                 /* Held by the owner while the word
+	                                   is a contended PI futex. */
+	int pi_waiters;                 /* Threads waiting for PI. */
+};
+
+/* A thread in FUTEX_WAIT. */
+struct futex_waiter {
+	struct list_elem elem;          /* Element in queue's waiters. */
+	struct thread *thread;          /* The waiting thread. */
+	struct semaphore wake;          /* Upped to wake THREAD. */
+};
+
+static struct hash queues;          /* futex_queues by key. */
+static struct lock futex_lock;      /* Protects QUEUES and the queues. */
+
+static int *word_get (int *uaddr, bool write, uint64_t *key);
+static void word_put (int *kaddr);
+static struct futex_queue *queue_find (uint64_t key);
+static struct futex_queue *queue_get (uint64_t key);
+static void queue_put (struct futex_queue *);
+static struct thread *live_owner (tid_t);
+static hash_hash_func queue_hash;
+static hash_less_func queue_less;
+static list_less_func waiter_more;
+
+/* Initializes the futex queues. */
+void
+futex_init (void) {
+	hash_init (&queues, queue_hash, queue_less, NULL);
+	lock_init (&futex_lock);
+}
+
+/* Sleeps until woken by futex_wake() on UADDR, if the word there
+ * still holds VAL.  Returns 0 after sleeping, or -1 if the word held
+ * something else, if UADDR is misaligned, or if memory is exhausted.
+ * Terminates the process if UADDR is bad. */
+int
+futex_wait (int *uaddr, int val) {
+	struct futex_waiter w;
+	struct futex_queue *q;
+	uint64_t key;
+	int *kaddr = word_get (uaddr, false, &key);
+
+	if (kaddr == NULL)
+		return -1;
+	lock_acquire (&futex_lock);
+	/* A thread that checks the word here cannot miss a wake-up: the
+	 * waker changes the word before it calls futex_wake(), which needs
+	 * FUTEX_LOCK. */
+	if (__atomic_load_n (kaddr, __ATOMIC_ACQUIRE) != val
+			|| uthread_killed (thread_current ())
+			|| (q = queue_get (key)) == NULL) {
+		lock_release (&futex_lock);
+		word_put (kaddr);
+		return -1;
+	}
+	w.thread = thread_current ();
+	sema_init (&w.wake, 0);
+	list_insert_ordered (&q->waiters, &w.elem, waiter_more, NULL);
+	lock_release (&futex_lock);
+
+	sema_down (&w.wake);
+
+	lock_acquire (&futex_lock);
+	queue_put (q);
+	lock_release (&futex_lock);
+	word_put (kaddr);
+	return 0;
+}
+
+/* Wakes up to CNT threads sleeping in futex_wait() on UADDR, highest
+ * priority first.  Returns the number woken, or -1 if UADDR is
+ * misaligned.  Terminates the process if UADDR is bad. */
+int
+futex_wake (int *uaddr, int cnt) {
+	struct futex_queue *q;
+	uint64_t key;
+	int *kaddr = word_get (uaddr, false, &key);
+	int woken = 0;
+
+	if (kaddr == NULL)
+		return -1;
+	lock_acquire (&futex_lock);
+	q = queue_find (key);
+	while (q != NULL && woken < cnt && !list_empty (&q->waiters)) {
+		struct futex_waiter *w = list_entry (list_pop_front (&q->waiters),
+				struct futex_waiter, elem);
+		sema_up (&w->wake);
+		woken++;
+	}
+	lock_release (&futex_lock);
+	word_put (kaddr);
+	return woken;
+}
+
+/* Locks the PI futex at UADDR for the current thread, which found it
+ * locked, sleeping until its owner unlocks it meanwhile raising the
+ * owner's priority to the caller's.  Takes over the lock of a thread
+ * that no longer exists.  Returns 0 once the caller owns the futex,
+ * or -1 if the caller already does, if UADDR is misaligned or
+ * read-only, or if memory is exhausted.  Terminates the process if
+ * UADDR is bad. */
+int
+futex_lock_pi (int *uaddr) {
+	struct thread *curr = thread_current ();
+	struct futex_queue *q;
+	uint64_t key;
+	int *kaddr = word_get (uaddr, true, &key);
+	int result = -1;
+
+	if (kaddr == NULL)
+		return -1;
+	lock_acquire (&futex_lock);
+	for (;;) {
+		int word = __atomic_load_n (kaddr, __ATOMIC_ACQUIRE);
+		tid_t owner_tid = word & ~FUTEX_WAITERS;
+		struct thread *owner;
+
+		if (owner_tid == curr->tid)
+			goto done;
+		q = queue_find (key);
+		/* The kernel lock says the caller owns the futex, whatever
+		 * user code wrote over the word since. */
+		if (q != NULL && q->pi.holder == curr)
+			goto done;
+		if (q != NULL && (q->pi_waiters > 0 || q->pi.holder != NULL)) {
+			q->users++;
+			break;
+		}
+
+		/* Uncontended as far as the kernel knows: take the word if it
+		 * is free or its owner is gone, else mark it contended and
+		 * make the owner hold the kernel lock.  User code may change
+		 * the word meanwhile, in which case try again. */
+		owner = owner_tid != 0 ? live_owner (owner_tid) : NULL;
+		if (owner == NULL) {
+			if (__atomic_compare_exchange_n (kaddr, &word, curr->tid, false,
+						__ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+				result = 0;
+				goto done;
+			}
+		} else if (__atomic_compare_exchange_n (kaddr, &word,
+					word | FUTEX_WAITERS, false,
+					__ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+			/* FUTEX_WAITERS alone only sends the owner through
+			 * futex_unlock_pi(), which copes without a queue. */
+			if ((q = queue_get (key)) == NULL)
+				goto done;
+			lock_acquire_for (&q->pi, owner);
+			break;
+		}
+	}
+	q->pi_waiters++;
+	lock_release (&futex_lock);
+
+	lock_acquire (&q->pi);
+
+	lock_acquire (&futex_lock);
+	q->pi_waiters--;
+	__atomic_store_n (kaddr,
+			curr->tid | (q->pi_waiters > 0 ? FUTEX_WAITERS : 0),
+			__ATOMIC_RELEASE);
+	/* Uncontended again: leave it to user code. */
+	if (q->pi_waiters == 0)
+		lock_release (&q->pi);
+	queue_put (q);
+	result = 0;
+
+done:
+	lock_release (&futex_lock);
+	word_put (kaddr);
+	return result;
+}
+
+/* Unlocks the PI futex at UADDR, which the current thread owns,
+ * handing it to the highest priority waiter, if any.  Returns 0 if
+ * successful, -1 if the caller is not the owner or UADDR is
+ * misaligned or read-only.  Terminates the process if UADDR is
+ * bad. */
+int
+futex_unlock_pi (int *uaddr) {
+	struct thread *curr = thread_current ();
+	struct futex_queue *q;
+	uint64_t key;
+	int *kaddr = word_get (uaddr, true, &key);
+	int result = -1;
+
+	if (kaddr == NULL)
+		return -1;
+	lock_acquire (&futex_lock);
+	if ((__atomic_load_n (kaddr, __ATOMIC_ACQUIRE) & ~FUTEX_WAITERS)
+			== curr->tid) {
+		q = queue_find (key);
+		if (q != NULL && q->pi.holder == curr) {
+			/* Unowned but contended until the next owner writes its
+			 * id, so that user code keeps off it meanwhile. */
+			__atomic_store_n (kaddr, FUTEX_WAITERS, __ATOMIC_RELEASE);
+			lock_release (&q->pi);
+		} else
+			__atomic_store_n (kaddr, 0, __ATOMIC_RELEASE);
+		result = 0;
+	}
+	lock_release (&futex_lock);
+	word_put (kaddr);
+	return result;
+}
+
+/* Passes on the PI futexes that T, the exiting thread, owns and
+ * others wait for. */
+void
+futex_exit (struct thread *t) {
+	struct hash_iterator i;
+
+	ASSERT (t == thread_current ());
+
+	lock_acquire (&futex_lock);
+	hash_first (&i, &queues);
+	while (hash_next (&i)) {
+		struct futex_queue *q = hash_entry (hash_cur (&i),
+				struct futex_queue, elem);
+		if (q->pi.holder == t) {
+			/* The waiters hold the frame. */
+			__atomic_store_n ((int *) ptov (q->key), FUTEX_WAITERS,
+					__ATOMIC_RELEASE);
+			lock_release (&q->pi);
+		}
+	}
+	lock_release (&futex_lock);
+}
+
+/* Wakes every thread of thread group G that sleeps in
+ * futex_wait(). */
+void
+futex_interrupt (const struct uthread_group *g) {
+	struct hash_iterator i;
+
+	lock_acquire (&futex_lock);
+	hash_first (&i, &queues);
+	while (hash_next (&i)) {
+		struct futex_queue *q = hash_entry (hash_cur (&i),
+				struct futex_queue, elem);
+		struct list_elem *e;
+
+		for (e = list_begin (&q->waiters); e != list_end (&q->waiters);) {
+			struct futex_waiter *w = list_entry (e, struct futex_waiter, elem);
+			e = list_next (e);
+			if (w->thread->group == g) {
+				list_remove (&w->elem);
+				sema_up (&w->wake);
+			}
+		}
+	}
+	lock_release (&futex_lock);
+}
+
+/* Finds the int at user address UADDR of the current process,
+ * faulting its page in as needed.  Returns the int's kernel address,
+ * with a reference to its frame for the caller to drop with
+ * word_put(), and stores its physical address in *KEY.  Returns a
+ * null pointer if UADDR is misaligned, or if WRITE is true and the
+ * page is read-only.  Terminates the process if UADDR is bad. */
+static int *
+word_get (int *uaddr, bool write, uint64_t *key) {
+	uint64_t *pml4 = thread_current ()->pml4;
+	uint64_t *pte;
+	int *kaddr = NULL;
+	int word;
+
+	if ((uintptr_t) uaddr % sizeof *uaddr != 0)
+		return NULL;
+	if (!copy_from_user (&word, uaddr, sizeof word))
+		syscall_exit (-1);
+
+	uthread_mm_acquire (thread_current ());
+	/* The first store to a copy-on-write page moves it to a frame of
+	 * its own, away from whoever waits on the old one, so copy it
+	 * now. */
+	pml4_cow_fault (pml4, uaddr);
+	pte = pml4e_walk (pml4, (uint64_t) uaddr, 0);
+	if (pte != NULL && (*pte & PTE_P) && (!write || is_writable (pte))) {
+		uint8_t *kpage = ptov (PTE_ADDR (*pte));
+		if (palloc_page_ref (kpage))
+			kaddr = (int *) (kpage + pg_ofs (uaddr));
+	}
+	uthread_mm_release (thread_current ());
+
+	if (kaddr != NULL)
+		*key = vtop (kaddr);
+	return kaddr;
+}
+
+/* Drops the frame reference that word_get() returned KADDR with. */
+static void
+word_put (int *kaddr) {
+	palloc_free_page (pg_round_down (kaddr));
+}
+
+/* Returns the queue for KEY, or a null pointer if there is none. */
+static struct futex_queue *
+queue_find (uint64_t key) {
+	struct futex_queue probe;
+	struct hash_elem *e;
+
+	probe.key = key;
+	e = hash_find (&queues, &probe.elem);
+	return e != NULL ? hash_entry (e, struct futex_queue, elem) : NULL;
+}
+
+/* Returns the queue for KEY, creating it if needed, with a use for
+ * the caller to drop with queue_put().  Returns a null pointer if
+ * memory is exhausted. */
+static struct futex_queue *
+queue_get (uint64_t key) {
+	struct futex_queue *q = queue_find (key);
+
+	if (q == NULL) {
+		q = malloc (sizeof *q);
+		if (q == NULL)
+			return NULL;
+		q->key = key;
+		q->users = 0;
+		list_init (&q->waiters);
+		lock_init (&q->pi);
+		q->pi_waiters = 0;
+		hash_insert (&queues, &q->elem);
+	}
+	q->users++;
+	return q;
+}
+
+/* Drops a use of Q, freeing it with the last one. */
+static void
+queue_put (struct futex_queue *q) {
+	ASSERT (q->users > 0);
+	if (--q->users == 0) {
+		ASSERT (list_empty (&q->waiters));
+		ASSERT (q->pi_waiters == 0 && q->pi.holder == NULL);
+		hash_delete (&queues, &q->elem);
+		free (q);
+	}
+}
+
+/* Returns the user thread whose id is TID, or a null pointer if there
+ * is none.  Threads leave the thread table before they reach
+ * futex_exit(), and holding FUTEX_LOCK keeps one found here from
+ * getting past it. */
+static struct thread *
+live_owner (tid_t tid) {
+	struct thread *t = thread_find (tid);
+
+	return t != NULL && t->pml4 != NULL ? t : NULL;
+}
+
+static uint64_t
+queue_hash (const struct hash_elem *e, void *aux UNUSED) {
+	uint64_t key = hash_entry (e, struct futex_queue, elem)->key;
+	return hash_bytes (&key, sizeof key);
+}
+
+static bool
+queue_less (const struct hash_elem *a, const struct hash_elem *b,
+		void *aux UNUSED) {
+	return hash_entry (a, struct futex_queue, elem)->key
+		< hash_entry (b, struct futex_queue, elem)->key;
+}
+
+/* Orders futex_waiters by decreasing priority. */
+static bool
+waiter_more (const struct list_elem *a, const struct list_elem *b,
+		void *aux UNUSED) {
+	return list_entry (a, struct futex_waiter, elem)->thread->priority
+		> list_entry (b, struct futex_waiter, elem)->thread->priority;
+}
@@ -0,0 +1,122 @@
+#include "userprog/heap.h"
+#include <debug.h>
+#include "threads/mmu.h"
+#include "threads/palloc.h"
+#include "threads/thread.h"
+#include "threads/vaddr.h"
+#include "userprog/uthread.h"
+
+/* Process heaps.
+ *
+ * A process's heap runs from the first page past its executable up
+ * to its break, which brk() and sbrk() move.  Moving the break up only
+ * records it: heap_fault() allocates each page, zeroed, the first time
+ * the process, or the kernel on its behalf, touches it.  Moving the
+ * break down frees the pages that had been touched, so memory given
+ * back through sbrk() really goes back to the kernel.
+ *
+ * The heap never grows over a page that is already mapped, such as
+ * shared memory or a ring, nor into the stacks of the process's
+ * threads.  Those threads all use the heap of the process's leader,
+ * and take turns changing it with uthread_mm_acquire(). */
+
+static bool set_break (struct thread *, uint8_t *brk);
+
+/* Starts T's heap, empty, on the first page boundary at or past END,
+ * the end of its executable. */
+void
+heap_init (struct thread *t, void *end) {
+	t->heap_base = t->heap_brk = pg_round_up (end);
+}
+
+/* Gives CHILD the heap bounds of PARENT's process, whose pages it has
+ * copied. */
+void
+heap_copy (struct thread *child, struct thread *parent) {
+	parent = uthread_leader (parent);
+	child->heap_base = parent->heap_base;
+	child->heap_brk = parent->heap_brk;
+}
+
+/* Moves the current process's break by INCREMENT bytes.  Returns the
+ * old break, or (void *) -1 if the break cannot move that far. */
+void *
+heap_sbrk (intptr_t increment) {
+	struct thread *t = uthread_leader (thread_current ());
+	uint8_t *old;
+
+	uthread_mm_acquire (thread_current ());
+	old = t->heap_brk;
+	if ((increment > 0 && (uintptr_t) increment > (uintptr_t) USER_STACK)
+			|| (increment < 0 && (uintptr_t) -increment
+				> (uintptr_t) (old - t->heap_base))
+			|| (increment != 0 && !set_break (t, old + increment)))
+		old = (void *) -1;
+	uthread_mm_release (thread_current ());
+	return old;
+}
+
+/* Moves the current process's break to ADDR.  Returns false if the
+ * break cannot go there. */
+bool
+heap_brk (void *addr) {
+	bool ok;
+
+	uthread_mm_acquire (thread_current ());
+	ok = set_break (uthread_leader (thread_current ()), addr);
+	uthread_mm_release (thread_current ());
+	return ok;
+}
+
+/* Handles a fault at VA, in user space, on a page that is not
+ * present, with uthread_mm_acquire() in effect.  If VA lies in the
+ * current process's heap, makes sure a zeroed page is mapped there
+ * and returns true.  Returns false otherwise, or if memory is
+ * exhausted. */
+bool
+heap_fault (const void *va) {
+	struct thread *t = uthread_leader (thread_current ());
+	uint8_t *upage = pg_round_down (va);
+	void *kpage;
+
+	if (t->pml4 == NULL || upage < t->heap_base
+			|| upage >= (uint8_t *) pg_round_up (t->heap_brk))
+		return false;
+
+	/* Another thread may have faulted it in first. */
+	if (pml4_get_page (t->pml4, upage) != NULL)
+		return true;
+	kpage = palloc_get_page (PAL_USER | PAL_ZERO);
+	if (kpage == NULL)
+		return false;
+	if (!pml4_set_page (t->pml4, upage, kpage, true)) {
+		palloc_free_page (kpage);
+		return false;
+	}
+	return true;
+}
+
+/* Moves T's break to BRK, freeing the pages that drop out of the
+ * heap.  Returns false, changing nothing, if BRK is out of range or
+ * the heap would grow over a mapped page. */
+static bool
+set_break (struct thread *t, uint8_t *brk) {
+	uint8_t *old_top = pg_round_up (t->heap_brk);
+	uint8_t *new_top = pg_round_up (brk);
+	uint8_t *upage;
+	struct tlb_batch batch;
+
+	if (brk < t->heap_base || brk > UTHREAD_STACKS_BOTTOM)
+		return false;
+
+	for (upage = old_top; upage < new_top; upage += PGSIZE)
+		if (pml4_get_page (t->pml4, upage) != NULL)
+			return false;
+	tlb_batch_begin (&batch, t->pml4);
+	for (upage = new_top; upage < old_top; upage += PGSIZE)
+		pml4_release_page (t->pml4, upage);
+	tlb_batch_flush (&batch);
+
+	t->heap_brk = brk;
+	return true;
+}
@@ -0,0 +1,363 @@
+#include "userprog/pipe.h"
+#include <debug.h>
+#include <list.h>
+#include <string.h>
+#include "threads/malloc.h"
+#include "threads/mmu.h"
+#include "threads/palloc.h"
+#include "threads/synch.h"
+#include "threads/thread.h"
+#include "threads/vaddr.h"
+#include "threads/waitq.h"
+#include "user/syscall.h"
+#include "userprog/syscall.h"
+#include "userprog/uaccess.h"
+#include "userprog/uthread.h"
+
+/* Pipes.
+ *
+ * A pipe is a queue of chunks of at most a page each, PIPE_MAX_PAGES
+ * of them at most.  Writers block while the queue is full and readers
+ * while it is empty, until the other side is gone: a read with no
+ * writers left returns 0, a write with no readers left fails.
+ *
+ * Small writes are copied into kernel pages, filling up the last chunk
+ * before starting a new one.  A write that covers a whole page-aligned
+ * page instead queues the writer's frame itself, with
+ * pml4_share_page(), which leaves the writer's mapping copy-on-write.
+ * A read of such a chunk into a whole page-aligned page maps the frame
+ * there with pml4_replace_page() instead of copying it, so a large
+ * transfer moves each page once in each direction without touching
+ * its contents, unless one side writes to it while the other still
+ * maps it.
+ *
+ * A non-blocking read or write returns what it could do without
+ * waiting, or -1 if that was nothing.  Pollers are woken whenever the
+ * readers or the writers might find something changed, and blocked
+ * readers and writers wait as pollers too, so that a thread whose
+ * process is exiting stops waiting (poller_interrupt()).
+ *
+ * User memory is never touched with the pipe's lock held, so that a
+ * fault on it cannot deadlock against a close() that holds
+ * filesys_lock. */
+
+#define PIPE_MAX_PAGES 16           /* Most chunks queued in a pipe. */
+
+#ifdef VM
+/* Frames under VM belong to the frame table, which evicts them on its
+ * own, so pipes always copy. */
+#define PIPE_FLIP false
+#else
+#define PIPE_FLIP true
+#endif
+
+/* Data queued in a pipe. */
+struct pipe_chunk {
+	struct list_elem elem;          /* Element in pipe's chunks. */
+	uint8_t *kpage;                 /* Data page. */
+	size_t ofs;                     /* Offset of the first unread byte. */
+	size_t len;                     /* Offset past the last byte. */
+	bool flipped;                   /* KPAGE is a shared user frame. */
+};
+
+struct pipe {
+	struct lock lock;               /* Protects the members below. */
+	struct list chunks;             /* Queued pipe_chunks, oldest first. */
+	size_t chunk_cnt;               /* Number of chunks queued. */
+	int readers;                    /* Number of open read ends. */
+	int writers;                    /* Number of open write ends. */
+	struct waitq pollers;           /* Woken on any change. */
+};
+
+static size_t tail_room (struct pipe *);
+static bool pipe_wait (struct pipe *);
+static bool deliver_page (void *upage, void *kpage);
+
+/* Returns a new pipe with one reference to each end, or a null pointer
+ * if memory is exhausted. */
+struct pipe *
+pipe_create (void) {
+	struct pipe *p = malloc (sizeof *p);
+	if (p == NULL)
+		return NULL;
+	lock_init (&p->lock);
+	list_init (&p->chunks);
+	p->chunk_cnt = 0;
+	p->readers = p->writers = 1;
+	waitq_init (&p->pollers);
+	return p;
+}
+
+/* Opens another reference to P's write end if WRITE_END is true, and
+ * to its read end otherwise. */
+void
+pipe_open (struct pipe *p, bool write_end) {
+	lock_acquire (&p->lock);
+	if (write_end)
+		p->writers++;
+	else
+		p->readers++;
+	lock_release (&p->lock);
+}
+
+/* Closes a reference to one end of P, as in pipe_open(), waking up
+ * whoever waits on the other end.  Frees P along with the last
+ * reference to either end. */
+void
+pipe_close (struct pipe *p, bool write_end) {
+	bool dead;
+
+	lock_acquire (&p->lock);
+	if (write_end)
+		p->writers--;
+	else
+		p->readers--;
+	ASSERT (p->readers >= 0 && p->writers >= 0);
+	waitq_wake (&p->pollers);
+	dead = p->readers == 0 && p->writers == 0;
+	lock_release (&p->lock);
+
+	if (dead) {
+		while (!list_empty (&p->chunks)) {
+			struct pipe_chunk *c = list_entry (list_pop_front (&p->chunks),
+					struct pipe_chunk, elem);
+			palloc_free_page (c->kpage);
+			free (c);
+		}
+		free (p);
+	}
+}
+
+/* Reads up to SIZE bytes from P into user buffer UBUF, waiting until
+ * some data is queued or every write end is closed, unless NONBLOCK
+ * is true.  Returns the number of bytes read, 0 at end of file, or -1
+ * if NONBLOCK is true and there was nothing to read yet or if the
+ * caller's process is exiting.  Terminates the process if UBUF is
+ * bad. */
+int
+pipe_read (struct pipe *p, void *ubuf_, size_t size, bool nonblock) {
+	uint8_t *ubuf = ubuf_;
+	uint8_t *bounce = NULL;
+	size_t done = 0;
+
+	if (size == 0)
+		return 0;
+
+	lock_acquire (&p->lock);
+	while (list_empty (&p->chunks) && p->writers > 0)
+		if (nonblock || !pipe_wait (p)) {
+			lock_release (&p->lock);
+			return -1;
+		}
+	while (done < size && !list_empty (&p->chunks)) {
+		struct pipe_chunk *c = list_entry (list_front (&p->chunks),
+				struct pipe_chunk, elem);
+		uint8_t *dst = ubuf + done;
+		void *kpage = NULL;
+		size_t n;
+
+		if (c->flipped && c->ofs == 0 && pg_ofs (dst) == 0
+				&& size - done >= PGSIZE) {
+			/* Take the whole frame. */
+			list_remove (&c->elem);
+			p->chunk_cnt--;
+			kpage = c->kpage;
+			n = PGSIZE;
+			free (c);
+		} else {
+			if (bounce == NULL && (bounce = palloc_get_page (0)) == NULL)
+				break;
+			n = c->len - c->ofs < size - done ? c->len - c->ofs : size - done;
+			memcpy (bounce, c->kpage + c->ofs, n);
+			c->ofs += n;
+			if (c->ofs == c->len) {
+				list_remove (&c->elem);
+				p->chunk_cnt--;
+				palloc_free_page (c->kpage);
+				free (c);
+			}
+		}
+		waitq_wake (&p->pollers);
+		lock_release (&p->lock);
+
+		if (kpage != NULL ? !deliver_page (dst, kpage)
+				: !copy_to_user (dst, bounce, n)) {
+			palloc_free_page (bounce);
+			syscall_exit (-1);
+		}
+		done += n;
+		lock_acquire (&p->lock);
+	}
+	lock_release (&p->lock);
+
+	palloc_free_page (bounce);
+	return done;
+}
+
+/* Writes SIZE bytes from user buffer UBUF to P, waiting for room as
+ * needed unless NONBLOCK is true.  Returns the number of bytes
+ * written, which is less than SIZE only if the read ends were all
+ * closed, memory ran out, NONBLOCK is true and P filled up, or the
+ * caller's process is exiting, or -1 if nothing could be written.
+ * Terminates the process if UBUF is bad. */
+int
+pipe_write (struct pipe *p, const void *ubuf_, size_t size, bool nonblock) {
+	const uint8_t *ubuf = ubuf_;
+	uint8_t *stage = NULL;
+	size_t done = 0;
+
+	if (size == 0)
+		return 0;
+
+	while (done < size) {
+		const uint8_t *src = ubuf + done;
+		size_t left = size - done;
+		struct pipe_chunk *c;
+		void *kpage = NULL;
+		bool flipped;
+		size_t n;
+
+		if (PIPE_FLIP && pg_ofs (src) == 0 && left >= PGSIZE) {
+			uthread_mm_acquire (thread_current ());
+			kpage = pml4_share_page (thread_current ()->pml4, src);
+			uthread_mm_release (thread_current ());
+		}
+		flipped = kpage != NULL;
+		if (flipped)
+			n = PGSIZE;
+		else {
+			/* Stop at a page boundary, so that the rest can be
+			 * flipped. */
+			n = left < PGSIZE ? left : PGSIZE - (PIPE_FLIP ? pg_ofs (src) : 0);
+			if (stage == NULL && (stage = palloc_get_page (0)) == NULL)
+				break;
+			if (!copy_from_user (stage, src, n)) {
+				palloc_free_page (stage);
+				syscall_exit (-1);
+			}
+			kpage = stage;
+		}
+
+		c = malloc (sizeof *c);
+		if (c == NULL) {
+			if (flipped)
+				palloc_free_page (kpage);
+			break;
+		}
+
+		lock_acquire (&p->lock);
+		while (p->readers > 0 && p->chunk_cnt >= PIPE_MAX_PAGES
+				&& (flipped || tail_room (p) < n))
+			if (nonblock || !pipe_wait (p))
+				break;
+		if (p->readers == 0 || (p->chunk_cnt >= PIPE_MAX_PAGES
+					&& (flipped || tail_room (p) < n))) {
+			lock_release (&p->lock);
+			free (c);
+			if (flipped)
+				palloc_free_page (kpage);
+			break;
+		}
+
+		if (!flipped && tail_room (p) >= n) {
+			struct pipe_chunk *tail = list_entry (list_back (&p->chunks),
+					struct pipe_chunk, elem);
+			memcpy (tail->kpage + tail->len, stage, n);
+			tail->len += n;
+			free (c);
+		} else {
+			c->kpage = kpage;
+			c->ofs = 0;
+			c->len = n;
+			c->flipped = flipped;
+			list_push_back (&p->chunks, &c->elem);
+			p->chunk_cnt++;
+			if (!flipped)
+				stage = NULL;
+		}
+		waitq_wake (&p->pollers);
+		lock_release (&p->lock);
+		done += n;
+	}
+
+	if (stage != NULL)
+		palloc_free_page (stage);
+	return done > 0 ? (int) done : -1;
+}
+
+/* Returns the poll() events pending on the end of P that WRITE_END
+ * names.  Unless POLLER is null, also hooks it onto P through E, to be
+ * woken on any change. */
+int
+pipe_poll (struct pipe *p, bool write_end, struct poller *poller,
+		struct waitq_entry *e) {
+	int events = 0;
+
+	lock_acquire (&p->lock);
+	if (poller != NULL)
+		poller_add (poller, &p->pollers, e);
+	if (write_end) {
+		if (p->readers == 0)
+			events |= POLLERR;
+		else if (p->chunk_cnt < PIPE_MAX_PAGES || tail_room (p) > 0)
+			events |= POLLOUT;
+	} else {
+		if (!list_empty (&p->chunks))
+			events |= POLLIN;
+		if (p->writers == 0)
+			events |= POLLHUP;
+	}
+	lock_release (&p->lock);
+	return events;
+}
+
+/* Waits, with P's lock held, until P changes.  Returns false without
+ * waiting if the current thread has been interrupted. */
+static bool
+pipe_wait (struct pipe *p) {
+	struct poller poller;
+	struct waitq_entry e;
+
+	poller_init (&poller);
+	if (poller_interrupted (&poller))
+		return false;
+	/* Hooked on before letting go of the lock, so no change after the
+	 * caller's check goes unnoticed. */
+	poller_add (&poller, &p->pollers, &e);
+	lock_release (&p->lock);
+	poller_wait (&poller, -1);
+	lock_acquire (&p->lock);
+	poller_remove (&e);
+	return !poller_interrupted (&poller);
+}
+
+/* Returns the number of bytes that still fit in the last chunk of P
+ * without starting a new one. */
+static size_t
+tail_room (struct pipe *p) {
+	struct pipe_chunk *tail;
+
+	if (list_empty (&p->chunks))
+		return 0;
+	tail = list_entry (list_back (&p->chunks), struct pipe_chunk, elem);
+	return tail->flipped ? 0 : PGSIZE - tail->len;
+}
+
+/* Puts the contents of frame KPAGE, to which the caller holds a
+ * reference, at user page UPAGE: by mapping KPAGE there if possible,
+ * otherwise by copying it.  Consumes the caller's reference either
+ * way.  Returns false if UPAGE is bad. */
+static bool
+deliver_page (void *upage, void *kpage) {
+	struct thread *curr = thread_current ();
+	bool ok;
+
+	uthread_mm_acquire (curr);
+	ok = pml4_replace_page (curr->pml4, upage, kpage);
+	uthread_mm_release (curr);
+	if (ok)
+		return true;
+	ok = copy_to_user (upage, kpage, PGSIZE);
+	palloc_free_page (kpage);
+	return ok;
+}
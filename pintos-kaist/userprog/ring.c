@@ -0,0 +1,198 @@
+#include "userprog/ring.h"
+#include <debug.h>
+#include <ring.h>
+#include <round.h>
+#include <syscall-nr.h>
+#include "threads/interrupt.h"
+#include "threads/malloc.h"
+#include "threads/mmu.h"
+#include "threads/palloc.h"
+#include "threads/thread.h"
+#include "threads/vaddr.h"
+#include "userprog/syscall.h"
+#include "userprog/uthread.h"
+#ifdef VM
+#include "vm/vm.h"
+#endif
+
+/* Kernel side of a process's shared ring (see lib/ring.h).
+ *
+ * The ring's pages come from the user pool and are mapped into the
+ * process like any other user page, so they go away with its page
+ * tables.  The kernel reaches them through their kernel addresses and
+ * never faults on them.  It keeps its own copies of the queue sizes
+ * and of the heads it owns, because the process can scribble over the
+ * shared ones at any time.
+ *
+ * ring_enter() runs the queued requests in the calling thread, through
+ * syscall_handler(), so one kernel entry pays for a whole batch.  A
+ * ring is not inherited across fork(), and exec() tears it down. */
+struct io_ring {
+	struct ring *r;             /* Shared ring, by kernel address. */
+	uint32_t sq_entries;        /* Submission queue size. */
+	uint32_t cq_entries;        /* Completion queue size. */
+	uint32_t sq_head;           /* Next request to take. */
+	uint32_t cq_tail;           /* Next completion slot to fill. */
+};
+
+static int64_t ring_run (const struct ring_sqe *);
+
+/* Maps a new ring with ENTRIES submission slots, a power of 2 no
+ * bigger than RING_MAX_ENTRIES, at page-aligned user address UADDR.
+ * Returns 0 if successful, -1 if the arguments are bad, the range is
+ * already in use, the process already has a ring, or memory is
+ * exhausted. */
+int
+ring_setup (void *uaddr, unsigned entries) {
+	struct thread *curr = thread_current ();
+	size_t size = RING_SIZE (entries);
+	size_t pages = DIV_ROUND_UP (size, PGSIZE);
+	struct io_ring *ring;
+	uint8_t *kpages;
+	size_t i;
+
+	if (curr->ring != NULL || entries == 0 || entries > RING_MAX_ENTRIES
+			|| (entries & (entries - 1)) != 0)
+		return -1;
+	if (uaddr == NULL || pg_ofs (uaddr) != 0 || !is_user_vaddr (uaddr)
+			|| pages > (KERN_BASE - (uintptr_t) uaddr) / PGSIZE)
+		return -1;
+
+	ring = malloc (sizeof *ring);
+	if (ring == NULL)
+		return -1;
+	kpages = palloc_get_multiple (PAL_USER | PAL_ZERO, pages);
+	if (kpages == NULL) {
+		free (ring);
+		return -1;
+	}
+
+	/* The process's other threads must not fault pages in meanwhile. */
+	uthread_mm_acquire (curr);
+	for (i = 0; i < pages; i++) {
+		void *upage = (uint8_t *) uaddr + i * PGSIZE;
+		if (pml4_get_page (curr->pml4, upage) != NULL)
+			goto error;
+#ifdef VM
+		if (spt_find_page (&curr->spt, upage) != NULL)
+			goto error;
+#endif
+	}
+	for (i = 0; i < pages; i++)
+		if (!pml4_set_page (curr->pml4, (uint8_t *) uaddr + i * PGSIZE,
+					kpages + i * PGSIZE, true)) {
+			struct tlb_batch batch;
+
+			tlb_batch_begin (&batch, curr->pml4);
+			while (i-- > 0)
+				pml4_clear_page (curr->pml4, (uint8_t *) uaddr + i * PGSIZE);
+			tlb_batch_flush (&batch);
+			goto error;
+		}
+	for (i = 0; i < pages; i++)
+		pml4_pin_page (curr->pml4, (uint8_t *) uaddr + i * PGSIZE);
+	uthread_mm_release (curr);
+
+	ring->r = (struct ring *) kpages;
+	ring->sq_entries = ring->r->sq_entries = entries;
+	ring->cq_entries = ring->r->cq_entries = 2 * entries;
+	ring->sq_head = ring->cq_tail = 0;
+	curr->ring = ring;
+	return 0;
+
+error:
+	uthread_mm_release (curr);
+	palloc_free_multiple (kpages, pages);
+	free (ring);
+	return -1;
+}
+
+/* Runs up to TO_SUBMIT queued requests of the current process's ring,
+ * posting a completion for each.  Stops early if the submission queue
+ * runs dry or the completion queue fills up.  Returns the number of
+ * requests taken, or -1 if the process has no ring or has corrupted
+ * its submission tail. */
+int
+ring_enter (unsigned to_submit) {
+	struct io_ring *ring = thread_current ()->ring;
+	struct ring *r;
+	uint32_t queued;
+	unsigned taken;
+	bool cancel = false;
+
+	if (ring == NULL)
+		return -1;
+	r = ring->r;
+	queued = __atomic_load_n (&r->sq_tail, __ATOMIC_ACQUIRE) - ring->sq_head;
+	if (queued > ring->sq_entries)
+		return -1;
+	if (to_submit > queued)
+		to_submit = queued;
+
+	for (taken = 0; taken < to_submit; taken++) {
+		uint32_t cq_head = __atomic_load_n (&r->cq_head, __ATOMIC_ACQUIRE);
+		struct ring_sqe sqe;
+		struct ring_cqe *cqe;
+		int64_t res;
+
+		if (ring->cq_tail - cq_head >= ring->cq_entries)
+			break;
+
+		/* Copy the request out first: the process may still write
+		 * to the slot. */
+		sqe = r->sqes[ring->sq_head & (ring->sq_entries - 1)];
+		ring->sq_head++;
+		__atomic_store_n (&r->sq_head, ring->sq_head, __ATOMIC_RELEASE);
+
+		res = cancel ? RING_CANCELED : ring_run (&sqe);
+		cancel = (sqe.flags & RING_F_LINK) && (cancel || res < 0);
+
+		cqe = &ring_cqes (r)[ring->cq_tail & (ring->cq_entries - 1)];
+		cqe->user_data = sqe.user_data;
+		cqe->res = res;
+		ring->cq_tail++;
+		__atomic_store_n (&r->cq_tail, ring->cq_tail, __ATOMIC_RELEASE);
+	}
+	return taken;
+}
+
+/* Forgets T's ring, if any.  Its pages belong to T's page tables,
+ * which must be on their way out. */
+void
+ring_destroy (struct thread *t) {
+	free (t->ring);
+	t->ring = NULL;
+}
+
+/* Runs the system call SQE describes and returns its result, or -1 if
+ * it is not one a ring may run. */
+static int64_t
+ring_run (const struct ring_sqe *sqe) {
+	struct intr_frame f;
+
+	f.R.rax = sqe->opcode;
+	f.R.rdi = sqe->args[0];
+	f.R.rsi = sqe->args[1];
+	f.R.rdx = sqe->args[2];
+	f.R.r10 = sqe->args[3];
+	switch (sqe->opcode) {
+		case SYS_SEEK:
+		case SYS_CLOSE:
+		case SYS_CREATE:
+		case SYS_REMOVE:
+		case SYS_OPEN:
+		case SYS_FILESIZE:
+		case SYS_READ:
+		case SYS_WRITE:
+		case SYS_TELL:
+		case SYS_DUP2:
+		case SYS_PREAD:
+		case SYS_PWRITE:
+		case SYS_READV:
+		case SYS_WRITEV:
+			syscall_handler (&f);
+			return (int64_t) f.R.rax;
+		default:
+			return -1;
+	}
+}
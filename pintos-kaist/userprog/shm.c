@@ -0,0 +1,139 @@
+#include "userprog/shm.h"
+#include <debug.h>
+#include <round.h>
+#include <stdint.h>
+#include "threads/interrupt.h"
+#include "threads/malloc.h"
+#include "threads/mmu.h"
+#include "threads/palloc.h"
+#include "threads/thread.h"
+#include "threads/vaddr.h"
+#include "userprog/uthread.h"
+#ifdef VM
+#include "vm/vm.h"
+#endif
+
+/* Shared memory objects.
+ *
+ * shm_open() creates an object of zeroed user frames and returns a
+ * descriptor for it, which fork() passes on and close() drops like any
+ * other.  shm_attach() maps the whole object with pml4_set_shm_page(),
+ * so each mapping holds its own references to the frames.  Unmapping,
+ * exit and fork() therefore need nothing from the object, which lives
+ * only as long as its descriptors, and each frame is freed when the
+ * last of the object and the mappings lets go of it. */
+struct shm {
+	int refcnt;                 /* Descriptions referring to this. */
+	size_t page_cnt;            /* Number of frames. */
+	void *frames[];             /* Frames, by kernel address. */
+};
+
+/* Returns a new object of SIZE bytes, rounded up to whole pages, all
+ * zero, with one reference.  Returns a null pointer if SIZE is 0 or
+ * too big, or if memory is exhausted. */
+struct shm *
+shm_create (size_t size) {
+	size_t page_cnt = DIV_ROUND_UP (size, PGSIZE);
+	struct shm *shm;
+
+	if (page_cnt == 0 || page_cnt > SHM_MAX_PAGES)
+		return NULL;
+	shm = malloc (sizeof *shm + page_cnt * sizeof *shm->frames);
+	if (shm == NULL)
+		return NULL;
+	shm->refcnt = 1;
+	shm->page_cnt = 0;
+	while (shm->page_cnt < page_cnt) {
+		void *kpage = palloc_get_page (PAL_USER | PAL_ZERO);
+		if (kpage == NULL) {
+			shm_close (shm);
+			return NULL;
+		}
+		shm->frames[shm->page_cnt++] = kpage;
+	}
+	return shm;
+}
+
+/* Takes another reference to SHM. */
+void
+shm_ref (struct shm *shm) {
+	enum intr_level old_level = intr_disable ();
+	shm->refcnt++;
+	intr_set_level (old_level);
+}
+
+/* Drops a reference to SHM, freeing it with the last one.  Frames that
+ * are still mapped stay with their mappings. */
+void
+shm_close (struct shm *shm) {
+	enum intr_level old_level = intr_disable ();
+	bool last = --shm->refcnt == 0;
+	intr_set_level (old_level);
+
+	if (last) {
+		for (size_t i = 0; i < shm->page_cnt; i++)
+			palloc_free_page (shm->frames[i]);
+		free (shm);
+	}
+}
+
+/* Maps all of SHM into the current process at page-aligned user
+ * address ADDR, read-only unless WRITABLE.  Returns ADDR, or a null
+ * pointer if ADDR is bad, any part of the range is in use, or memory
+ * is exhausted. */
+void *
+shm_attach (struct shm *shm, void *addr, bool writable) {
+	struct thread *curr = thread_current ();
+	uint8_t *base = addr;
+	size_t i;
+
+	if (addr == NULL || pg_ofs (addr) != 0 || !is_user_vaddr (addr)
+			|| shm->page_cnt > (KERN_BASE - (uintptr_t) addr) / PGSIZE)
+		return NULL;
+
+	/* The process's other threads must not fault pages in meanwhile. */
+	uthread_mm_acquire (curr);
+	for (i = 0; i < shm->page_cnt; i++) {
+		if (pml4_get_page (curr->pml4, base + i * PGSIZE) != NULL)
+			goto error;
+#ifdef VM
+		if (spt_find_page (&curr->spt, base + i * PGSIZE) != NULL)
+			goto error;
+#endif
+	}
+	for (i = 0; i < shm->page_cnt; i++)
+		if (!pml4_set_shm_page (curr->pml4, base + i * PGSIZE, shm->frames[i],
+					writable)) {
+			while (i-- > 0)
+				pml4_clear_shm_page (curr->pml4, base + i * PGSIZE);
+			goto error;
+		}
+	uthread_mm_release (curr);
+	return addr;
+
+error:
+	uthread_mm_release (curr);
+	return NULL;
+}
+
+/* Unmaps the shared memory pages of the current process in the SIZE
+ * bytes starting at page-aligned user address ADDR, leaving any other
+ * page there alone.  Returns false if the range is bad. */
+bool
+shm_detach (void *addr, size_t size) {
+	struct thread *curr = thread_current ();
+	uint8_t *base = addr;
+	size_t page_cnt = DIV_ROUND_UP (size, PGSIZE);
+	struct tlb_batch batch;
+
+	if (pg_ofs (addr) != 0 || !is_user_vaddr (addr)
+			|| page_cnt > (KERN_BASE - (uintptr_t) addr) / PGSIZE)
+		return false;
+	uthread_mm_acquire (curr);
+	tlb_batch_begin (&batch, curr->pml4);
+	for (size_t i = 0; i < page_cnt; i++)
+		pml4_clear_shm_page (curr->pml4, base + i * PGSIZE);
+	tlb_batch_flush (&batch);
+	uthread_mm_release (curr);
+	return true;
+}
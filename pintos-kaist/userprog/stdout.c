@@ -0,0 +1,102 @@
+#include "userprog/stdout.h"
+#include <stdio.h>
+#include <string.h>
+#include "threads/malloc.h"
+#include "threads/synch.h"
+
+/* Buffered console output.
+ *
+ * Each process's console output description keeps a line buffer, so
+ * that a program printing a line in pieces reaches the console, and
+ * takes the console lock, once per line instead of once per write().
+ * Everything up to the last new-line of a write goes out right away,
+ * in one putbuf() together with what was pending if it fits; the rest
+ * waits for the next new-line or for the buffer to fill up.  A write
+ * too big for the buffer bypasses it.
+ *
+ * Pending output is flushed before the process reads the console,
+ * forks, reports its exit status, or is killed, so that it comes out
+ * in the order the process produced it relative to the kernel's own
+ * messages about the process. */
+
+#define STDOUT_BUF_SIZE 256         /* Bytes buffered at most. */
+
+struct stdout_buf {
+	struct lock lock;               /* Serializes the process's threads. */
+	size_t len;                     /* Number of bytes pending. */
+	char data[STDOUT_BUF_SIZE];     /* Pending output. */
+};
+
+static void flush_locked (struct stdout_buf *);
+
+/* Returns a new, empty buffer, or a null pointer if memory is
+ * exhausted. */
+struct stdout_buf *
+stdout_create (void) {
+	struct stdout_buf *b = malloc (sizeof *b);
+	if (b == NULL)
+		return NULL;
+	lock_init (&b->lock);
+	b->len = 0;
+	return b;
+}
+
+/* Writes the N bytes in S to the console through B. */
+void
+stdout_write (struct stdout_buf *b, const char *s, size_t n) {
+	size_t lines = n;
+
+	while (lines > 0 && s[lines - 1] != '\n')
+		lines--;
+
+	lock_acquire (&b->lock);
+	if (lines > 0) {
+		/* Complete lines go out now, with the pending partial line in
+		 * front of them. */
+		if (b->len + lines <= STDOUT_BUF_SIZE) {
+			memcpy (b->data + b->len, s, lines);
+			b->len += lines;
+			flush_locked (b);
+		} else {
+			flush_locked (b);
+			putbuf (s, lines);
+		}
+		s += lines;
+		n -= lines;
+	}
+	if (b->len + n > STDOUT_BUF_SIZE)
+		flush_locked (b);
+	if (n >= STDOUT_BUF_SIZE)
+		putbuf (s, n);
+	else {
+		memcpy (b->data + b->len, s, n);
+		b->len += n;
+	}
+	lock_release (&b->lock);
+}
+
+/* Writes whatever B holds to the console. */
+void
+stdout_flush (struct stdout_buf *b) {
+	lock_acquire (&b->lock);
+	flush_locked (b);
+	lock_release (&b->lock);
+}
+
+/* Flushes and frees B.  B may be null. */
+void
+stdout_destroy (struct stdout_buf *b) {
+	if (b == NULL)
+		return;
+	stdout_flush (b);
+	free (b);
+}
+
+/* Writes whatever B holds to the console.  B's lock must be held. */
+static void
+flush_locked (struct stdout_buf *b) {
+	if (b->len > 0) {
+		putbuf (b->data, b->len);
+		b->len = 0;
+	}
+}
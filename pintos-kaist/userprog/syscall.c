@@ -1,412 +1,1377 @@
-#include "userprog/syscall.h"
-#include <stdio.h>
-#include <syscall-nr.h>
-#include "threads/interrupt.h"
-#include "threads/thread.h"
-#include "threads/loader.h"
-#include "userprog/gdt.h"
-#include "threads/flags.h"
-#include "intrinsic.h"
-/*------[ Project 2 System Call]------*/
-// #include "threads/init.h"
-#include "user/syscall.h"
-#include "filesys/filesys.h"
-#include "filesys/file.h"
-#include "userprog/process.h" 
-
-
-void syscall_entry (void);
-void syscall_handler (struct intr_frame *);
-
-/*------[ Project 2 System Call]------*/
-int syscall_exec(const char *cmd_line);
-bool syscall_create(const char *file, unsigned initial_size);
-int syscall_wait(pid_t pid);
-pid_t syscall_fork(const char *thread_name, struct intr_frame *if_ UNUSED);
-void syscall_exit(int status);
-int syscall_write(int fd, const void *buffer, unsigned size);
-void syscall_half(void);
-bool syscall_remove(const char *file);
-int syscall_open(const char *file);
-int syscall_filesize(int fd);
-int syscall_read(int fd, void *buffer, unsigned size);
-void syscall_seek(int fd, unsigned position);
-unsigned syscall_tell(int fd);
-void syscall_close(int fd);
-
-void check_addr(const void *addr);
-struct file *fd_tofile(int fd);
-/* System call.
- *
- * Previously system call services was handled by the interrupt handler
- * (e.g. int 0x80 in linux). However, in x86-64, the manufacturer supplies
- * efficient path for requesting the system call, the `syscall` instruction.
- *
- * The syscall instruction works by reading the values from the the Model
- * Specific Register (MSR). For the details, see the manual. */
-
-#define MSR_STAR 0xc0000081         /* Segment selector msr */
-#define MSR_LSTAR 0xc0000082        /* Long mode SYSCALL target */
-#define MSR_SYSCALL_MASK 0xc0000084 /* Mask for the eflags */
-
-void syscall_init(void) {
-	write_msr(MSR_STAR, ((uint64_t)SEL_UCSEG - 0x10) << 48  |
-			((uint64_t)SEL_KCSEG) << 32);
-	write_msr(MSR_LSTAR, (uint64_t) syscall_entry);
-
-	/* The interrupt service rountine should not serve any interrupts
-	 * until the syscall_entry swaps the userland stack to the kernel
-	 * mode stack. Therefore, we masked the FLAG_FL. */
-	write_msr(MSR_SYSCALL_MASK,
-			FLAG_IF | FLAG_TF | FLAG_DF | FLAG_IOPL | FLAG_AC | FLAG_NT);
-	lock_init(&filesys_lock);
-}
-
-void syscall_half(void)
-{
-	power_off();
-}
-
-bool syscall_create(const char *file, unsigned initial_size)
-{
-	check_addr(file);
-
-	lock_acquire(&filesys_lock);
-	bool cre = filesys_create(file, initial_size);
-	lock_release(&filesys_lock);
-	return cre;
-}
-
-int syscall_wait(pid_t pid)
-{
-	return process_wait(pid);
-}
-
-pid_t syscall_fork(const char *thread_name, struct intr_frame *if_ UNUSED)
-{
-	return process_fork(thread_name, if_);
-}
-
-void syscall_exit(int status)
-{
-	struct thread* curr = thread_current();
-	curr->exit_status = status;
-	printf("%s: exit(%d)\n", curr->name, status);
-	thread_exit();
-}
-
-int syscall_write(int fd, const void *buffer, unsigned size)
-{
-	check_addr(buffer);
-	check_addr(buffer + size - 1);
-
-	 if (size == 0)
-        return 0;
-		
-	if (fd == 1)
-	{
-		putbuf(buffer, size);
-		
-		return size;
-	}
-	else if (fd == 0)
-	{
-		syscall_exit(-1);
-	}
-	else if (fd > 1 && fd < 64)
-	{
-		struct file *write_file = fd_tofile(fd);
-		if (write_file == NULL)
-		{
-			syscall_exit(-1);
-		}
-		else
-		{
-			lock_acquire(&filesys_lock);
-			int wri = file_write(write_file, buffer, size);
-			lock_release(&filesys_lock);
-			return wri;
-		}
-	}
-	syscall_exit(-1);
-}
-
-int syscall_exec(const char* cmd_line){
-	check_addr(cmd_line);
-	if(process_exec(cmd_line)<0){
-		syscall_exit(-1);
-	}
-	return thread_current()->tid;
-}
- 
-
-
-bool syscall_remove(const char *file)
-{
-	check_addr(file);
-	lock_acquire(&filesys_lock);
-	bool rem = filesys_remove(file);
-	lock_release(&filesys_lock);
-	return rem;
-}
-
-int syscall_open(const char *file)
-{
-	check_addr(file);
-	struct thread *curr = thread_current();
-
-	int open_fd;
-	bool is_not_full = false;
-	for (open_fd = 2; open_fd < 64; open_fd++)
-	{
-		if (curr->fd_table[open_fd] == NULL)
-		{
-			is_not_full = true;
-			break;
-		}
-	}
-	if (!is_not_full)
-		return -1;
-
-	lock_acquire(&filesys_lock);
-	struct file *open_file = filesys_open(file);
-	lock_release(&filesys_lock);
-	if (open_file == NULL)
-		return -1;
-
-	curr->fd_table[open_fd] = open_file;
-	curr->fd = open_fd;
-
-	return open_fd;
-}
-
-int syscall_filesize(int fd)
-{
-	lock_acquire(&filesys_lock);
-	struct file *size_file = fd_tofile(fd);
-	lock_release(&filesys_lock);
-
-	if (size_file == NULL)
-	{
-		syscall_exit(-1);
-	}
-
-	return file_length(size_file);
-}
-
-int syscall_read(int fd, void *buffer, unsigned size)
-{
-	check_addr(buffer);
-	check_addr(buffer + size - 1);
-
-	if (size == 0)
-	{
-		return 0;
-	}
-
-	if (fd == 0)
-	{
-		char *buf = (char *)buffer;
-		lock_acquire(&filesys_lock);
-		for (int i = 0; i < size; i++)
-		{
-			buf[i] = input_getc();
-		}
-		lock_release(&filesys_lock);
-		return size;
-	}
-	else if (fd == 1)
-	{
-		syscall_exit(-1);
-	}
-	else if (fd > 1 && fd < 64)
-	{
-
-		struct file *read_file = fd_tofile(fd);
-		if (read_file == NULL)
-		{
-			return 0;
-		}
-		else
-		{
-			lock_acquire(&filesys_lock);
-			int rea = file_read(read_file, buffer, size);
-			lock_release(&filesys_lock);
-			return rea;
-		}
-	}
-	syscall_exit(-1);
-}
-
-void syscall_seek(int fd, unsigned position)
-{
-	if (fd < 2)
-	{
-		return;
-	}
-
-	struct file *seek_file = fd_tofile(fd);
-	// check_addr(seek_file);
-
-	if (seek_file == NULL)
-	{
-		return;
-	}
-	lock_acquire(&filesys_lock);
-	file_seek(seek_file, position);
-	lock_release(&filesys_lock);
-}
-
-unsigned syscall_tell(int fd)
-{
-	if (fd < 2)
-	{
-		return 0;
-	}
-
-	if (fd < 0 || 64 <= fd)
-	{
-		return 0;
-	}
-
-	struct file *tell_file = fd_tofile(fd);
-	// check_addr(tell_file);
-
-	if (tell_file == NULL)
-	{
-		return 0;
-	}
-	lock_acquire(&filesys_lock);
-	unsigned tell = file_tell(tell_file);
-	lock_release(&filesys_lock);
-
-	return tell;
-}
-
-void syscall_close(int fd)
-{
-	struct thread *curr = thread_current();
-
-	if (fd < 2)
-	{
-		return;
-	}
-
-	struct file *cl_file = fd_tofile(fd);
-	// check_addr(cl_file);
-
-	if (cl_file == NULL)
-	{
-		syscall_exit(-1);
-	}
-
-	if (fd < 0 || 64 <= fd)
-	{
-		return;
-	}
-
-	lock_acquire(&filesys_lock);
-	file_close(cl_file);
-	lock_release(&filesys_lock);
-	curr->fd_table[fd] = NULL;
-}
-
-/* The main system call interface */
-void
-syscall_handler (struct intr_frame *f UNUSED) {
-	uint64_t sys_number = f->R.rax;
-	// printf("syscall Number%d\n", sys_number);
-	switch (sys_number)
-	{
-	case SYS_HALT:
-		syscall_half();
-		break;
-	case SYS_EXIT: 
-		syscall_exit(f->R.rdi);
-	break;
-	case SYS_FORK:
-		f->R.rax = syscall_fork((const char *)f->R.rdi, f);
-		break;
-	case SYS_EXEC: 
-		f->R.rax = syscall_exec((const char*) f->R.rdi);
-		break;
-	case SYS_WAIT: 
-		f->R.rax = syscall_wait((pid_t)f->R.rdi);
-		break;
-	case SYS_CREATE: 
-		f->R.rax = syscall_create((const char *)f->R.rdi, (unsigned) f->R.rsi);
-		break;
-	case SYS_REMOVE:
-		f->R.rax = syscall_remove((const char *)f->R.rdi);
-		break;
-	case SYS_OPEN:
-		f->R.rax = syscall_open((const char *)f->R.rdi);
-		break;
-	case SYS_FILESIZE:
-		f->R.rax = syscall_filesize((int)f->R.rdi);
-		break;
-	case SYS_READ:
-		f->R.rax = syscall_read((int)f->R.rdi, (void *)f->R.rsi, (unsigned)f->R.rdx);
-		break;
-	case SYS_WRITE:
-		f->R.rax = syscall_write((int)f->R.rdi, (const void *)f->R.rsi, (unsigned)f->R.rdx);
-		break;
-	case SYS_SEEK:
-		syscall_seek((int)f->R.rdi, (unsigned)f->R.rsi);
-		break;
-	case SYS_TELL:
-		f->R.rax = syscall_tell((int)f->R.rdi);
-		break;
-	case SYS_CLOSE:
-		syscall_close((int)f->R.rdi);
-		break;
-	case SYS_MMAP:
-		break;
-	case SYS_MUNMAP:
-		break;
-	case SYS_CHDIR:
-		break;
-	case SYS_MKDIR:
-		break;
-	case SYS_READDIR:
-		break;
-	case SYS_ISDIR:
-		break;
-	case SYS_INUMBER:
-		break;
-	case SYS_SYMLINK:
-		break;
-	case SYS_DUP2:
-		break;
-	case SYS_MOUNT:
-		break;
-	case SYS_UMOUNT:
-		break;
-	default:
-		thread_exit();
-		break;
-	}
-}
-
-//////////////
-void check_addr(const void *addr)
-{
-	if (addr == NULL)
-		syscall_exit(-1);
-	if (!is_user_vaddr(addr))
-		syscall_exit(-1);
-	if (pml4_get_page(thread_current()->pml4, addr) == NULL)
-		syscall_exit(-1);
-}
-
-struct file *fd_tofile(int fd)
-{
-	if (fd < 0 || 64 <= fd)
-	{
-		return NULL;
-	}
-
-	struct thread *curr = thread_current();
-	struct file *file = curr->fd_table[fd];
-	return file;
-}
\ No newline at end of file
+#include "userprog/syscall.h"
+#include <stdio.h>
+#include <syscall-nr.h>
+#include "threads/interrupt.h"
+#include "threads/thread.h"
+#include "threads/loader.h"
+#include "userprog/gdt.h"
+#include "threads/flags.h"
+#include "intrinsic.h"
+/*------[ Project 2 System Call]------*/
+// #include "threads/init.h"
+#include "user/syscall.h"
+#include "filesys/filesys.h"
+#include "filesys/file.h"
+#include "userprog/process.h" 
+#include "userprog/fd.h"
+#include "userprog/uaccess.h"
+#include "userprog/ring.h"
+#include "userprog/heap.h"
+#include "userprog/pipe.h"
+#include "userprog/shm.h"
+#include "userprog/stdout.h"
+#include "userprog/uthread.h"
+#include "userprog/futex.h"
+#include "devices/input.h"
+#include "devices/timer.h"
+#include "threads/palloc.h"
+#include "threads/vaddr.h"
+#include "threads/waitq.h"
+#include <inttypes.h>
+#include <klog.h>
+#include <limits.h>
+#include <round.h>
+#include "threads/malloc.h"
+
+
+void syscall_entry (void);
+
+/*------[ Project 2 System Call]------*/
+int syscall_exec(const char *cmd_line);
+bool syscall_create(const char *file, unsigned initial_size);
+int syscall_wait(pid_t pid);
+pid_t syscall_fork(const char *thread_name, struct intr_frame *if_ UNUSED);
+void syscall_exit(int status);
+int syscall_write(int fd, const void *buffer, unsigned size);
+void syscall_half(void);
+bool syscall_remove(const char *file);
+int syscall_open(const char *file);
+int syscall_filesize(int fd);
+int syscall_read(int fd, void *buffer, unsigned size);
+void syscall_seek(int fd, unsigned position);
+unsigned syscall_tell(int fd);
+void syscall_close(int fd);
+int syscall_dup2(int oldfd, int newfd);
+int syscall_pread(int fd, void *buffer, unsigned size, off_t offset);
+int syscall_pwrite(int fd, const void *buffer, unsigned size, off_t offset);
+int syscall_readv(int fd, const struct iovec *iov, int iovcnt);
+int syscall_writev(int fd, const struct iovec *iov, int iovcnt);
+int syscall_stats(int nr, bool global, struct syscall_stat *ust);
+int syscall_pipe(int *fds);
+int syscall_shm_open(size_t size);
+void *syscall_shm_map(int fd, void *addr, bool writable);
+int syscall_shm_unmap(void *addr, size_t size);
+pid_t syscall_spawn(const char *cmd_line, const struct spawn_action *actions,
+		int action_cnt);
+pid_t syscall_vfork(struct intr_frame *if_);
+int syscall_brk(void *addr);
+void *syscall_sbrk(intptr_t increment);
+pid_t syscall_thread_spawn(void *entry, void *func, void *aux);
+int syscall_thread_join(pid_t tid);
+void syscall_thread_exit(int status);
+pid_t syscall_gettid(void);
+int syscall_futex(int *addr, int op, int val);
+int syscall_fcntl(int fd, int cmd, int arg);
+int syscall_poll(struct pollfd *ufds, int nfds, int timeout_ms);
+int syscall_dmesg(char *ubuf, unsigned size);
+
+bool copy_in_string(char *dst, const char *usrc, size_t size);
+
+/* Longest file name, plus null terminator, that create(), remove(),
+ * and open() copy in from user memory. */
+#define PATH_BUF_SIZE 256
+
+/* Most pages of kernel bounce buffer one read or write call uses. */
+#define BOUNCE_MAX_PAGES 16
+
+static int read_user(struct fdesc *desc, const struct iovec *iov, int iovcnt,
+		off_t ofs);
+static int desc_poll(struct fdesc *desc, struct poller *p,
+		struct waitq_entry *e);
+static int write_user(struct fdesc *desc, const struct iovec *iov, int iovcnt,
+		off_t ofs);
+static bool copy_in_iovec(struct iovec *dst, const struct iovec *uiov,
+		int iovcnt);
+static struct fdesc *get_desc(int fd);
+static void put_desc(void);
+static void *bounce_alloc(size_t size, size_t *cap);
+/* System call.
+ *
+ * Previously system call services was handled by the interrupt handler
+ * (e.g. int 0x80 in linux). However, in x86-64, the manufacturer supplies
+ * efficient path for requesting the system call, the `syscall` instruction.
+ *
+ * The syscall instruction works by reading the values from the the Model
+ * Specific Register (MSR). For the details, see the manual. */
+
+#define MSR_STAR 0xc0000081         /* Segment selector msr */
+#define MSR_LSTAR 0xc0000082        /* Long mode SYSCALL target */
+#define MSR_SYSCALL_MASK 0xc0000084 /* Mask for the eflags */
+
+void syscall_init(void) {
+	write_msr(MSR_STAR, ((uint64_t)SEL_UCSEG - 0x10) << 48  |
+			((uint64_t)SEL_KCSEG) << 32);
+	write_msr(MSR_LSTAR, (uint64_t) syscall_entry);
+
+	/* The interrupt service rountine should not serve any interrupts
+	 * until the syscall_entry swaps the userland stack to the kernel
+	 * mode stack. Therefore, we masked the FLAG_FL. */
+	write_msr(MSR_SYSCALL_MASK,
+			FLAG_IF | FLAG_TF | FLAG_DF | FLAG_IOPL | FLAG_AC | FLAG_NT);
+	lock_init(&filesys_lock);
+	futex_init();
+}
+
+void syscall_half(void)
+{
+	power_off();
+}
+
+bool syscall_create(const char *file, unsigned initial_size)
+{
+	char name[PATH_BUF_SIZE];
+	if (!copy_in_string(name, file, sizeof name))
+		return false;
+
+	lock_acquire(&filesys_lock);
+	bool cre = filesys_create(name, initial_size);
+	lock_release(&filesys_lock);
+	return cre;
+}
+
+int syscall_wait(pid_t pid)
+{
+	return process_wait(pid);
+}
+
+pid_t syscall_fork(const char *thread_name, struct intr_frame *if_ UNUSED)
+{
+	char name[sizeof thread_current()->name];
+
+	/* Thread names are truncated anyway. */
+	if (strncpy_from_user(name, thread_name, sizeof name) < 0)
+		syscall_exit(-1);
+	name[sizeof name - 1] = '\0';
+	return process_fork(name, if_);
+}
+
+void syscall_exit(int status)
+{
+	struct thread* curr = thread_current();
+	curr->exit_status = status;
+	/* The process's buffered output comes before its exit status. */
+	fd_flush(curr->fd_table);
+	/* Of the threads of one process, only the first to exit reports. */
+	if (uthread_kill(curr))
+		printf("%s: exit(%d)\n", curr->name, curr->exit_status);
+	thread_exit();
+}
+
+int syscall_write(int fd, const void *buffer, unsigned size)
+{
+	struct fdesc *desc = get_desc(fd);
+	if (desc == NULL || desc->kind == FD_STDIN)
+	{
+		syscall_exit(-1);
+	}
+
+	struct iovec iov = {(void *)buffer, size};
+	int n = write_user(desc, &iov, 1, -1);
+	put_desc();
+	return n;
+}
+
+int syscall_exec(const char* cmd_line){
+	/* The process's other threads run in the address space that exec()
+	 * would replace. */
+	if (!uthread_single(thread_current()))
+		return -1;
+
+	/* process_exec() frees the page. */
+	char *cmd_copy = palloc_get_page(0);
+	if (cmd_copy == NULL)
+		syscall_exit(-1);
+
+	int64_t len = strncpy_from_user(cmd_copy, cmd_line, PGSIZE);
+	if (len < 0 || len == PGSIZE)
+	{
+		palloc_free_page(cmd_copy);
+		syscall_exit(-1);
+	}
+	if(process_exec(cmd_copy)<0){
+		syscall_exit(-1);
+	}
+	return thread_current()->tid;
+}
+ 
+
+
+bool syscall_remove(const char *file)
+{
+	char name[PATH_BUF_SIZE];
+	if (!copy_in_string(name, file, sizeof name))
+		return false;
+
+	lock_acquire(&filesys_lock);
+	bool rem = filesys_remove(name);
+	lock_release(&filesys_lock);
+	return rem;
+}
+
+int syscall_open(const char *file)
+{
+	char name[PATH_BUF_SIZE];
+	if (!copy_in_string(name, file, sizeof name))
+		return -1;
+	struct thread *curr = thread_current();
+
+	lock_acquire(&filesys_lock);
+	struct file *open_file = filesys_open(name);
+	lock_release(&filesys_lock);
+	if (open_file == NULL)
+		return -1;
+
+	int open_fd = fd_alloc(curr->fd_table, FD_FILE, open_file);
+	if (open_fd < 0)
+	{
+		lock_acquire(&filesys_lock);
+		file_close(open_file);
+		lock_release(&filesys_lock);
+	}
+
+	return open_fd;
+}
+
+int syscall_filesize(int fd)
+{
+	struct fdesc *desc = get_desc(fd);
+	if (desc == NULL || desc->kind != FD_FILE)
+	{
+		syscall_exit(-1);
+	}
+
+	lock_acquire(&filesys_lock);
+	int size = file_length(desc->file);
+	lock_release(&filesys_lock);
+	put_desc();
+	return size;
+}
+
+int syscall_read(int fd, void *buffer, unsigned size)
+{
+	struct fdesc *desc = get_desc(fd);
+	if (desc == NULL)
+	{
+		return -1;
+	}
+	else if (desc->kind == FD_STDOUT)
+	{
+		syscall_exit(-1);
+	}
+
+	struct iovec iov = {buffer, size};
+	int n = read_user(desc, &iov, 1, -1);
+	put_desc();
+	return n;
+}
+
+void syscall_seek(int fd, unsigned position)
+{
+	struct fdesc *desc = get_desc(fd);
+	// check_addr(seek_file);
+
+	if (desc != NULL && desc->kind == FD_FILE)
+	{
+		lock_acquire(&filesys_lock);
+		file_seek(desc->file, position);
+		lock_release(&filesys_lock);
+	}
+	put_desc();
+}
+
+unsigned syscall_tell(int fd)
+{
+	struct fdesc *desc = get_desc(fd);
+	// check_addr(tell_file);
+	unsigned tell = 0;
+
+	if (desc != NULL && desc->kind == FD_FILE)
+	{
+		lock_acquire(&filesys_lock);
+		tell = file_tell(desc->file);
+		lock_release(&filesys_lock);
+	}
+	put_desc();
+	return tell;
+}
+
+void syscall_close(int fd)
+{
+	struct thread *curr = thread_current();
+
+	lock_acquire(&filesys_lock);
+	bool closed = fd_close(curr->fd_table, fd);
+	lock_release(&filesys_lock);
+
+	if (!closed)
+	{
+		syscall_exit(-1);
+	}
+}
+
+int syscall_dup2(int oldfd, int newfd)
+{
+	struct thread *curr = thread_current();
+
+	/* May close NEWFD's file. */
+	lock_acquire(&filesys_lock);
+	int fd = fd_dup2(curr->fd_table, oldfd, newfd);
+	lock_release(&filesys_lock);
+	return fd;
+}
+
+int syscall_pread(int fd, void *buffer, unsigned size, off_t offset)
+{
+	struct fdesc *desc = get_desc(fd);
+	int n = -1;
+	if (desc != NULL && desc->kind == FD_FILE && offset >= 0)
+	{
+		struct iovec iov = {buffer, size};
+		n = read_user(desc, &iov, 1, offset);
+	}
+	put_desc();
+	return n;
+}
+
+int syscall_pwrite(int fd, const void *buffer, unsigned size, off_t offset)
+{
+	struct fdesc *desc = get_desc(fd);
+	int n = -1;
+	if (desc != NULL && desc->kind == FD_FILE && offset >= 0)
+	{
+		struct iovec iov = {(void *)buffer, size};
+		n = write_user(desc, &iov, 1, offset);
+	}
+	put_desc();
+	return n;
+}
+
+int syscall_readv(int fd, const struct iovec *iov, int iovcnt)
+{
+	struct iovec kiov[IOV_MAX];
+
+	if (!copy_in_iovec(kiov, iov, iovcnt))
+		return -1;
+	struct fdesc *desc = get_desc(fd);
+	if (desc == NULL)
+		return -1;
+	else if (desc->kind == FD_STDOUT)
+		syscall_exit(-1);
+	int n = read_user(desc, kiov, iovcnt, -1);
+	put_desc();
+	return n;
+}
+
+/* Gathering the buffers into one file_write() makes a header and the
+ * body after it land together. */
+int syscall_writev(int fd, const struct iovec *iov, int iovcnt)
+{
+	struct iovec kiov[IOV_MAX];
+
+	if (!copy_in_iovec(kiov, iov, iovcnt))
+		return -1;
+	struct fdesc *desc = get_desc(fd);
+	if (desc == NULL || desc->kind == FD_STDIN)
+		syscall_exit(-1);
+	int n = write_user(desc, kiov, iovcnt, -1);
+	put_desc();
+	return n;
+}
+
+/* Creates a pipe and stores its read and write descriptors in user
+ * array FDS.  Returns 0 if successful, -1 if out of descriptors or
+ * memory. */
+int syscall_pipe(int *fds)
+{
+	struct fd_table *t = thread_current()->fd_table;
+	struct pipe *p = pipe_create();
+	int kfds[2];
+
+	if (p == NULL)
+		return -1;
+	kfds[0] = fd_alloc_pipe(t, FD_PIPE_READ, p);
+	if (kfds[0] < 0)
+	{
+		pipe_close(p, false);
+		pipe_close(p, true);
+		return -1;
+	}
+	kfds[1] = fd_alloc_pipe(t, FD_PIPE_WRITE, p);
+	if (kfds[1] < 0)
+	{
+		fd_close(t, kfds[0]);
+		pipe_close(p, true);
+		return -1;
+	}
+	if (!copy_to_user(fds, kfds, sizeof kfds))
+		syscall_exit(-1);
+	return 0;
+}
+
+/* Creates a zeroed shared memory object of SIZE bytes and returns a
+ * descriptor for it, or -1 if SIZE is bad or out of descriptors or
+ * memory. */
+int syscall_shm_open(size_t size)
+{
+	struct shm *shm = shm_create(size);
+	if (shm == NULL)
+		return -1;
+
+	int fd = fd_alloc_shm(thread_current()->fd_table, shm);
+	if (fd < 0)
+		shm_close(shm);
+	return fd;
+}
+
+/* Maps the shared memory object behind FD at ADDR.  Returns ADDR, or
+ * MAP_FAILED if FD is not shared memory or the mapping fails. */
+void *syscall_shm_map(int fd, void *addr, bool writable)
+{
+	struct fdesc *desc = get_desc(fd);
+	void *map = MAP_FAILED;
+	if (desc != NULL && desc->kind == FD_SHM)
+		map = shm_attach(desc->shm, addr, writable);
+	put_desc();
+	return map;
+}
+
+int syscall_shm_unmap(void *addr, size_t size)
+{
+	return shm_detach(addr, size) ? 0 : -1;
+}
+
+/* Starts a process running CMD_LINE with the descriptors set up by
+ * ACTION_CNT ACTIONS.  Returns its pid, or PID_ERROR if ACTION_CNT is
+ * out of range or the process cannot be started. */
+pid_t syscall_spawn(const char *cmd_line, const struct spawn_action *actions,
+		int action_cnt)
+{
+	struct spawn_action acts[SPAWN_ACTIONS_MAX];
+
+	if (action_cnt < 0 || action_cnt > SPAWN_ACTIONS_MAX)
+		return PID_ERROR;
+	if (!copy_from_user(acts, actions, action_cnt * sizeof *acts))
+		syscall_exit(-1);
+
+	char *cmd_copy = palloc_get_page(0);
+	if (cmd_copy == NULL)
+		return PID_ERROR;
+	int64_t len = strncpy_from_user(cmd_copy, cmd_line, PGSIZE);
+	if (len < 0 || len == PGSIZE)
+	{
+		palloc_free_page(cmd_copy);
+		syscall_exit(-1);
+	}
+
+	pid_t pid = process_spawn(cmd_copy, acts, action_cnt);
+	palloc_free_page(cmd_copy);
+	return pid;
+}
+
+pid_t syscall_vfork(struct intr_frame *if_)
+{
+	return process_vfork(thread_current()->name, if_);
+}
+
+int syscall_brk(void *addr)
+{
+	return heap_brk(addr) ? 0 : -1;
+}
+
+void *syscall_sbrk(intptr_t increment)
+{
+	return heap_sbrk(increment);
+}
+
+/* Starts a thread in the current process at user address ENTRY, with
+ * FUNC and AUX as its arguments.  Returns its tid, or PID_ERROR. */
+pid_t syscall_thread_spawn(void *entry, void *func, void *aux)
+{
+	tid_t tid = uthread_spawn(entry, func, aux);
+	return tid != TID_ERROR ? tid : PID_ERROR;
+}
+
+int syscall_thread_join(pid_t tid)
+{
+	return uthread_join(tid);
+}
+
+void syscall_thread_exit(int status)
+{
+	uthread_end(status);
+}
+
+pid_t syscall_gettid(void)
+{
+	return thread_current()->tid;
+}
+
+/* Runs futex operation OP on the int at ADDR, with VAL as its
+ * argument.  Returns -1 for an unknown OP. */
+int syscall_futex(int *addr, int op, int val)
+{
+	switch (op)
+	{
+	case FUTEX_WAIT:
+		return futex_wait(addr, val);
+	case FUTEX_WAKE:
+		return futex_wake(addr, val);
+	case FUTEX_LOCK_PI:
+		return futex_lock_pi(addr);
+	case FUTEX_UNLOCK_PI:
+		return futex_unlock_pi(addr);
+	default:
+		return -1;
+	}
+}
+
+/* Runs fcntl() command CMD on FD: F_GETFL returns its flags, and
+ * F_SETFL sets them to ARG and returns 0.  Returns -1 if FD is not
+ * open or CMD or ARG is bad. */
+int syscall_fcntl(int fd, int cmd, int arg)
+{
+	struct fdesc *desc = get_desc(fd);
+	int result = -1;
+
+	if (desc == NULL)
+		return -1;
+	if (cmd == F_GETFL)
+		result = desc->flags;
+	else if (cmd == F_SETFL && (arg & ~O_NONBLOCK) == 0)
+	{
+		desc->flags = arg;
+		result = 0;
+	}
+	put_desc();
+	return result;
+}
+
+/* Waits until one of the NFDS descriptors in user array UFDS has one
+ * of the events it asks for, or for TIMEOUT_MS milliseconds unless
+ * that is negative, and fills in their revents.  Returns the number
+ * of descriptors with events, 0 on timeout, or -1 if NFDS is out of
+ * range or memory is exhausted.  Terminates the process if UFDS is
+ * bad. */
+int syscall_poll(struct pollfd *ufds, int nfds, int timeout_ms)
+{
+	struct fd_table *t = thread_current()->fd_table;
+	struct pollfd *fds = NULL;
+	struct fdesc **descs = NULL;
+	struct waitq_entry *entries = NULL;
+	struct poller poller;
+	int64_t deadline = -1;
+	int ready = -1;
+	int i;
+
+	if (nfds < 0 || nfds > POLL_MAX)
+		return -1;
+	if (nfds > 0)
+	{
+		fds = malloc(nfds * sizeof *fds);
+		descs = malloc(nfds * sizeof *descs);
+		entries = malloc(nfds * sizeof *entries);
+		if (fds == NULL || descs == NULL || entries == NULL)
+			goto done;
+		if (!copy_from_user(fds, ufds, nfds * sizeof *fds))
+		{
+			free(fds);
+			free(descs);
+			free(entries);
+			syscall_exit(-1);
+		}
+	}
+
+	/* Nothing here touches user memory, so the descriptions need not
+	 * be tracked through get_desc(). */
+	for (i = 0; i < nfds; i++)
+	{
+		descs[i] = fds[i].fd >= 0 ? fd_get(t, fds[i].fd) : NULL;
+		entries[i].poller = NULL;
+	}
+	if (timeout_ms >= 0)
+		deadline = timer_ticks()
+				+ DIV_ROUND_UP((int64_t)timeout_ms * TIMER_FREQ, 1000);
+
+	/* Hook onto everything on the first pass, so that no change after
+	 * a check goes unnoticed. */
+	poller_init(&poller);
+	for (bool first = true;; first = false)
+	{
+		ready = 0;
+		for (i = 0; i < nfds; i++)
+		{
+			if (fds[i].fd < 0)
+				fds[i].revents = 0;
+			else if (descs[i] == NULL)
+				fds[i].revents = POLLNVAL;
+			else
+				fds[i].revents = desc_poll(descs[i], first ? &poller : NULL,
+						&entries[i]) & (fds[i].events | POLLERR | POLLHUP);
+			if (fds[i].revents != 0)
+				ready++;
+		}
+		/* A process that is exiting stops waiting. */
+		if (ready > 0 || poller_interrupted(&poller)
+				|| !poller_wait(&poller, deadline))
+			break;
+	}
+
+	for (i = 0; i < nfds; i++)
+	{
+		poller_remove(&entries[i]);
+		if (descs[i] != NULL)
+			fd_put(t, descs[i]);
+	}
+	if (nfds > 0 && !copy_to_user(ufds, fds, nfds * sizeof *fds))
+	{
+		free(fds);
+		free(descs);
+		free(entries);
+		syscall_exit(-1);
+	}
+
+done:
+	free(fds);
+	free(descs);
+	free(entries);
+	return ready;
+}
+
+/* Copies the most recent kernel log records that fit in SIZE bytes
+ * into user buffer UBUF, up to the size of a bounce buffer.  Returns
+ * the number of bytes copied, or -1 if memory is exhausted.
+ * Terminates the process if UBUF is bad. */
+int syscall_dmesg(char *ubuf, unsigned size)
+{
+	size_t cap, n;
+	char *bounce;
+
+	if (size == 0)
+		return 0;
+	bounce = bounce_alloc(size, &cap);
+	if (bounce == NULL)
+		return -1;
+	n = klog_read(bounce, size < cap ? size : cap);
+	if (!copy_to_user(ubuf, bounce, n))
+	{
+		palloc_free_multiple(bounce, cap / PGSIZE);
+		syscall_exit(-1);
+	}
+	palloc_free_multiple(bounce, cap / PGSIZE);
+	return n;
+}
+
+/* System call dispatch.
+ *
+ * Each system call number maps to a descriptor giving its handler, its
+ * name, and the kinds of its arguments.  syscall_handler() fetches the
+ * arguments from the interrupt frame, checks the pointer arguments
+ * against the user address range, and calls the handler; the copy
+ * routines in userprog/uaccess.c catch any pointer that is in range
+ * but not mapped.  Numbers without a handler return -1.
+ *
+ * Every call is counted, and the TSC cycles it took go into a log2
+ * histogram, both kernel-wide and for the calling process.  Calls that
+ * do not return (exit, a successful exec, halt) are counted without a
+ * latency. */
+
+/* Kinds of system call arguments. */
+enum sc_arg
+{
+	ARG_INT,					/* Plain value. */
+	ARG_PTR,					/* User pointer, may be null. */
+	ARG_STR,					/* User string, must not be null. */
+	ARG_BUF,					/* User buffer, sized by the next argument. */
+};
+
+#define SC_MAX_ARGS 4
+
+typedef uint64_t sc_handler_func(const uint64_t *args, struct intr_frame *);
+
+struct sc_desc
+{
+	sc_handler_func *handler;	/* Null if not implemented. */
+	const char *name;			/* Name, for statistics. */
+	int argc;					/* Number of arguments. */
+	enum sc_arg args[SC_MAX_ARGS];	/* Kinds of the arguments. */
+};
+
+static uint64_t sc_halt(const uint64_t *a UNUSED, struct intr_frame *f UNUSED)
+{
+	syscall_half();
+	NOT_REACHED();
+}
+
+static uint64_t sc_exit(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	syscall_exit((int)a[0]);
+	NOT_REACHED();
+}
+
+static uint64_t sc_fork(const uint64_t *a, struct intr_frame *f)
+{
+	return syscall_fork((const char *)a[0], f);
+}
+
+static uint64_t sc_exec(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_exec((const char *)a[0]);
+}
+
+static uint64_t sc_wait(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_wait((pid_t)a[0]);
+}
+
+static uint64_t sc_create(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_create((const char *)a[0], (unsigned)a[1]);
+}
+
+static uint64_t sc_remove(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_remove((const char *)a[0]);
+}
+
+static uint64_t sc_open(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_open((const char *)a[0]);
+}
+
+static uint64_t sc_filesize(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_filesize((int)a[0]);
+}
+
+static uint64_t sc_read(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_read((int)a[0], (void *)a[1], (unsigned)a[2]);
+}
+
+static uint64_t sc_write(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_write((int)a[0], (const void *)a[1], (unsigned)a[2]);
+}
+
+static uint64_t sc_seek(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	syscall_seek((int)a[0], (unsigned)a[1]);
+	return 0;
+}
+
+static uint64_t sc_tell(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_tell((int)a[0]);
+}
+
+static uint64_t sc_close(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	syscall_close((int)a[0]);
+	return 0;
+}
+
+static uint64_t sc_dup2(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_dup2((int)a[0], (int)a[1]);
+}
+
+static uint64_t sc_pread(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_pread((int)a[0], (void *)a[1], (unsigned)a[2], (off_t)a[3]);
+}
+
+static uint64_t sc_pwrite(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_pwrite((int)a[0], (const void *)a[1], (unsigned)a[2], (off_t)a[3]);
+}
+
+static uint64_t sc_readv(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_readv((int)a[0], (const struct iovec *)a[1], (int)a[2]);
+}
+
+static uint64_t sc_writev(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_writev((int)a[0], (const struct iovec *)a[1], (int)a[2]);
+}
+
+static uint64_t sc_ring_setup(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return ring_setup((void *)a[0], (unsigned)a[1]);
+}
+
+static uint64_t sc_ring_enter(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return ring_enter((unsigned)a[0]);
+}
+
+static uint64_t sc_syscall_stats(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_stats((int)a[0], (bool)a[1], (struct syscall_stat *)a[2]);
+}
+
+static uint64_t sc_pipe(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_pipe((int *)a[0]);
+}
+
+static uint64_t sc_shm_open(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_shm_open((size_t)a[0]);
+}
+
+static uint64_t sc_shm_map(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return (uint64_t)syscall_shm_map((int)a[0], (void *)a[1], (bool)a[2]);
+}
+
+static uint64_t sc_shm_unmap(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_shm_unmap((void *)a[0], (size_t)a[1]);
+}
+
+static uint64_t sc_spawn(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_spawn((const char *)a[0],
+			(const struct spawn_action *)a[1], (int)a[2]);
+}
+
+static uint64_t sc_vfork(const uint64_t *a UNUSED, struct intr_frame *f)
+{
+	return syscall_vfork(f);
+}
+
+static uint64_t sc_brk(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_brk((void *)a[0]);
+}
+
+static uint64_t sc_sbrk(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return (uint64_t)syscall_sbrk((intptr_t)a[0]);
+}
+
+static uint64_t sc_thread_spawn(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_thread_spawn((void *)a[0], (void *)a[1], (void *)a[2]);
+}
+
+static uint64_t sc_thread_join(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_thread_join((pid_t)a[0]);
+}
+
+static uint64_t sc_thread_exit(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	syscall_thread_exit((int)a[0]);
+	NOT_REACHED();
+}
+
+static uint64_t sc_gettid(const uint64_t *a UNUSED, struct intr_frame *f UNUSED)
+{
+	return syscall_gettid();
+}
+
+static uint64_t sc_futex(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_futex((int *)a[0], (int)a[1], (int)a[2]);
+}
+
+static uint64_t sc_fcntl(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_fcntl((int)a[0], (int)a[1], (int)a[2]);
+}
+
+static uint64_t sc_poll(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_poll((struct pollfd *)a[0], (int)a[1], (int)a[2]);
+}
+
+static uint64_t sc_dmesg(const uint64_t *a, struct intr_frame *f UNUSED)
+{
+	return syscall_dmesg((char *)a[0], (unsigned)a[1]);
+}
+
+static const struct sc_desc sc_table[SYS_CALL_CNT] = {
+	[SYS_HALT] = {sc_halt, "halt", 0, {}},
+	[SYS_EXIT] = {sc_exit, "exit", 1, {ARG_INT}},
+	[SYS_FORK] = {sc_fork, "fork", 1, {ARG_STR}},
+	[SYS_EXEC] = {sc_exec, "exec", 1, {ARG_STR}},
+	[SYS_WAIT] = {sc_wait, "wait", 1, {ARG_INT}},
+	[SYS_CREATE] = {sc_create, "create", 2, {ARG_STR, ARG_INT}},
+	[SYS_REMOVE] = {sc_remove, "remove", 1, {ARG_STR}},
+	[SYS_OPEN] = {sc_open, "open", 1, {ARG_STR}},
+	[SYS_FILESIZE] = {sc_filesize, "filesize", 1, {ARG_INT}},
+	[SYS_READ] = {sc_read, "read", 3, {ARG_INT, ARG_BUF, ARG_INT}},
+	[SYS_WRITE] = {sc_write, "write", 3, {ARG_INT, ARG_BUF, ARG_INT}},
+	[SYS_SEEK] = {sc_seek, "seek", 2, {ARG_INT, ARG_INT}},
+	[SYS_TELL] = {sc_tell, "tell", 1, {ARG_INT}},
+	[SYS_CLOSE] = {sc_close, "close", 1, {ARG_INT}},
+	[SYS_DUP2] = {sc_dup2, "dup2", 2, {ARG_INT, ARG_INT}},
+	[SYS_PREAD] = {sc_pread, "pread", 4, {ARG_INT, ARG_BUF, ARG_INT, ARG_INT}},
+	[SYS_PWRITE] = {sc_pwrite, "pwrite", 4, {ARG_INT, ARG_BUF, ARG_INT, ARG_INT}},
+	[SYS_READV] = {sc_readv, "readv", 3, {ARG_INT, ARG_PTR, ARG_INT}},
+	[SYS_WRITEV] = {sc_writev, "writev", 3, {ARG_INT, ARG_PTR, ARG_INT}},
+	[SYS_RING_SETUP] = {sc_ring_setup, "ring_setup", 2, {ARG_INT, ARG_INT}},
+	[SYS_RING_ENTER] = {sc_ring_enter, "ring_enter", 1, {ARG_INT}},
+	[SYS_SYSCALL_STATS] = {sc_syscall_stats, "syscall_stats", 3, {ARG_INT, ARG_INT, ARG_PTR}},
+	[SYS_PIPE] = {sc_pipe, "pipe", 1, {ARG_PTR}},
+	[SYS_SHM_OPEN] = {sc_shm_open, "shm_open", 1, {ARG_INT}},
+	[SYS_SHM_MAP] = {sc_shm_map, "shm_map", 3, {ARG_INT, ARG_INT, ARG_INT}},
+	[SYS_SHM_UNMAP] = {sc_shm_unmap, "shm_unmap", 2, {ARG_INT, ARG_INT}},
+	[SYS_SPAWN] = {sc_spawn, "spawn", 3, {ARG_STR, ARG_PTR, ARG_INT}},
+	[SYS_VFORK] = {sc_vfork, "vfork", 0, {}},
+	[SYS_BRK] = {sc_brk, "brk", 1, {ARG_INT}},
+	[SYS_SBRK] = {sc_sbrk, "sbrk", 1, {ARG_INT}},
+	[SYS_THREAD_SPAWN] = {sc_thread_spawn, "thread_spawn", 3, {ARG_PTR, ARG_INT, ARG_INT}},
+	[SYS_THREAD_JOIN] = {sc_thread_join, "thread_join", 1, {ARG_INT}},
+	[SYS_THREAD_EXIT] = {sc_thread_exit, "thread_exit", 1, {ARG_INT}},
+	[SYS_GETTID] = {sc_gettid, "gettid", 0, {}},
+	[SYS_FUTEX] = {sc_futex, "futex", 3, {ARG_PTR, ARG_INT, ARG_INT}},
+	[SYS_FCNTL] = {sc_fcntl, "fcntl", 3, {ARG_INT, ARG_INT, ARG_INT}},
+	[SYS_POLL] = {sc_poll, "poll", 3, {ARG_PTR, ARG_INT, ARG_INT}},
+	[SYS_DMESG] = {sc_dmesg, "dmesg", 2, {ARG_PTR, ARG_INT}},
+};
+
+/* Kernel-wide statistics.  Interrupts off. */
+static struct syscall_stat sc_stats[SYS_CALL_CNT];
+
+/* Terminates the process unless argument I of ARGS, of kind KIND, is
+ * acceptable. */
+static void sc_check_arg(enum sc_arg kind, const uint64_t *args, int i)
+{
+	uint64_t p = args[i];
+
+	switch (kind)
+	{
+	case ARG_INT:
+		break;
+	case ARG_PTR:
+		if (p >= KERN_BASE)
+			syscall_exit(-1);
+		break;
+	case ARG_STR:
+		if (p == 0 || p >= KERN_BASE)
+			syscall_exit(-1);
+		break;
+	case ARG_BUF:
+		/* Sizes are all unsigned ints. */
+		if (p >= KERN_BASE || p + (uint32_t)args[i + 1] > KERN_BASE)
+			syscall_exit(-1);
+		break;
+	}
+}
+
+/* Returns the log2 bucket for a latency of CYCLES. */
+static int sc_bucket(uint64_t cycles)
+{
+	int b = cycles == 0 ? 0 : 63 - __builtin_clzll(cycles);
+	return b < SYSCALL_HIST_BUCKETS ? b : SYSCALL_HIST_BUCKETS - 1;
+}
+
+/* Adds a call of NR to ST, with a latency of CYCLES unless CYCLES is
+ * -1, in which case only counts it. */
+static void sc_account(struct syscall_stat *st, int nr, uint64_t cycles)
+{
+	enum intr_level old_level = intr_disable();
+	if (cycles == (uint64_t)-1)
+		st[nr].count++;
+	else
+	{
+		st[nr].cycles += cycles;
+		st[nr].hist[sc_bucket(cycles)]++;
+	}
+	intr_set_level(old_level);
+}
+
+/* Returns the statistics of the current process, which its threads
+ * keep on its leader, allocating them on first use.  Returns NULL if
+ * memory is exhausted. */
+static struct syscall_stat *sc_proc_stats(void)
+{
+	struct thread *t = uthread_leader(thread_current());
+
+	if (t->sc_stats == NULL)
+	{
+		struct syscall_stat *st = calloc(SYS_CALL_CNT, sizeof *st);
+		enum intr_level old_level = intr_disable();
+		if (t->sc_stats == NULL)
+		{
+			t->sc_stats = st;
+			st = NULL;
+		}
+		intr_set_level(old_level);
+		free(st);
+	}
+	return t->sc_stats;
+}
+
+/* The main system call interface */
+void
+syscall_handler (struct intr_frame *f) {
+	uint64_t nr = f->R.rax;
+	uint64_t args[SC_MAX_ARGS] = {f->R.rdi, f->R.rsi, f->R.rdx, f->R.r10};
+	struct syscall_stat *own;
+	const struct sc_desc *d;
+	uint64_t start;
+
+	if (nr >= SYS_CALL_CNT || sc_table[nr].handler == NULL)
+	{
+		f->R.rax = -1;
+		return;
+	}
+	d = &sc_table[nr];
+	for (int i = 0; i < d->argc; i++)
+		sc_check_arg(d->args[i], args, i);
+
+	own = sc_proc_stats();
+	sc_account(sc_stats, nr, -1);
+	if (own != NULL)
+		sc_account(own, nr, -1);
+
+	start = rdtsc();
+	f->R.rax = d->handler(args, f);
+	uint64_t cycles = rdtsc() - start;
+
+	sc_account(sc_stats, nr, cycles);
+	if (own != NULL)
+		sc_account(own, nr, cycles);
+
+	/* Another thread may have called exit() meanwhile. */
+	uthread_check_killed();
+}
+
+/* Copies the statistics for system call NR, kernel-wide if GLOBAL is
+ * true and otherwise for the current process, to user address UST.
+ * Returns 0 if successful, -1 if NR is out of range. */
+int syscall_stats(int nr, bool global, struct syscall_stat *ust)
+{
+	struct syscall_stat *table = global ? sc_stats
+		: uthread_leader(thread_current())->sc_stats;
+	struct syscall_stat st;
+
+	if (nr < 0 || nr >= SYS_CALL_CNT || table == NULL)
+		return -1;
+	enum intr_level old_level = intr_disable();
+	st = table[nr];
+	intr_set_level(old_level);
+	if (!copy_to_user(ust, &st, sizeof st))
+		syscall_exit(-1);
+	return 0;
+}
+
+/* Prints the kernel-wide statistics of every system call made. */
+void syscall_print_stats(void)
+{
+	for (int nr = 0; nr < SYS_CALL_CNT; nr++)
+	{
+		const struct syscall_stat *st = &sc_stats[nr];
+		uint64_t timed = 0;
+
+		if (st->count == 0)
+			continue;
+		for (int b = 0; b < SYSCALL_HIST_BUCKETS; b++)
+			timed += st->hist[b];
+		printf("Syscall %s: %"PRIu64" calls, %"PRIu64" cycles avg;",
+				sc_table[nr].name, st->count,
+				timed != 0 ? st->cycles / timed : 0);
+		for (int b = 0; b < SYSCALL_HIST_BUCKETS; b++)
+			if (st->hist[b] != 0)
+				printf(" 2^%d:%"PRIu32, b, st->hist[b]);
+		printf("\n");
+	}
+}
+
+//////////////
+/* Copies the user string USRC into DST, which holds SIZE bytes.
+ * Terminates the process if USRC is not readable user memory, and
+ * returns false if the string does not fit. */
+bool copy_in_string(char *dst, const char *usrc, size_t size)
+{
+	int64_t len = strncpy_from_user(dst, usrc, size);
+	if (len < 0)
+		syscall_exit(-1);
+	return (size_t)len < size;
+}
+
+/* User buffers reach the file system through a kernel bounce buffer,
+ * so that a bad user pointer faults in copy_from_user() or
+ * copy_to_user() rather than deep inside the file system with
+ * filesys_lock held.  The bounce buffer covers up to BOUNCE_MAX_PAGES
+ * pages, so a transfer that fits takes filesys_lock once, whether it
+ * is a read(), a pread(), or a readv() of several buffers. */
+
+/* Allocates a bounce buffer for a SIZE-byte transfer, falling back to
+ * a single page if memory is tight, and stores its size in *CAP.
+ * Returns a null pointer if not even one page is free. */
+static void *bounce_alloc(size_t size, size_t *cap)
+{
+	size_t pages = DIV_ROUND_UP(size, PGSIZE);
+	void *buf = NULL;
+
+	if (pages > BOUNCE_MAX_PAGES)
+		pages = BOUNCE_MAX_PAGES;
+	if (pages > 1)
+		buf = palloc_get_multiple(0, pages);
+	if (buf == NULL)
+	{
+		pages = 1;
+		buf = palloc_get_page(0);
+	}
+	*cap = pages * PGSIZE;
+	return buf;
+}
+
+/* Returns the total length of the IOVCNT buffers in IOV, or -1 if it
+ * does not fit in an int. */
+static int64_t iov_total(const struct iovec *iov, int iovcnt)
+{
+	int64_t total = 0;
+	for (int i = 0; i < iovcnt; i++)
+	{
+		if (iov[i].iov_len > INT_MAX || (total += iov[i].iov_len) > INT_MAX)
+			return -1;
+	}
+	return total;
+}
+
+/* Copies SIZE bytes between kernel buffer KBUF and the user buffers in
+ * IOV, starting SKIP bytes into them, towards the user buffers if
+ * TO_USER is true.  Returns false if a user buffer is bad. */
+static bool iov_copy(const struct iovec *iov, size_t skip, char *kbuf,
+		size_t size, bool to_user)
+{
+	for (; size > 0; iov++)
+	{
+		if (skip >= iov->iov_len)
+		{
+			skip -= iov->iov_len;
+			continue;
+		}
+		char *ubuf = (char *)iov->iov_base + skip;
+		size_t n = iov->iov_len - skip < size ? iov->iov_len - skip : size;
+		if (to_user ? !copy_to_user(ubuf, kbuf, n) : !copy_from_user(kbuf, ubuf, n))
+			return false;
+		kbuf += n;
+		size -= n;
+		skip = 0;
+	}
+	return true;
+}
+
+/* Transfers between pipe end DESC and the IOVCNT user buffers in IOV,
+ * towards the pipe if WRITE is true.  A read stops after the first
+ * buffer it does not fill.  Pipes do their own copying, without
+ * filesys_lock.  Returns the number of bytes transferred, or -1 if
+ * DESC is the wrong end or nothing could be transferred. */
+static int pipe_user(struct fdesc *desc, const struct iovec *iov, int iovcnt,
+		bool write)
+{
+	int done = 0;
+
+	if (write != (desc->kind == FD_PIPE_WRITE))
+		return -1;
+	for (int i = 0; i < iovcnt; i++)
+	{
+		if (iov[i].iov_len == 0)
+			continue;
+		bool nonblock = (desc->flags & O_NONBLOCK) != 0;
+		int n = write
+				? pipe_write(desc->pipe, iov[i].iov_base, iov[i].iov_len, nonblock)
+				: pipe_read(desc->pipe, iov[i].iov_base, iov[i].iov_len, nonblock);
+		if (n < 0)
+			return done > 0 ? done : -1;
+		done += n;
+		if ((size_t)n < iov[i].iov_len)
+			break;
+	}
+	return done;
+}
+
+/* Reads from DESC into the IOVCNT user buffers in IOV, at offset OFS,
+ * or at the file position if OFS is negative.  From the console, reads
+ * the keys typed so far, waiting for one unless DESC is non-blocking.
+ * Returns the number of bytes read, or -1 on failure or if there was
+ * nothing to read without waiting.  Terminates the process if a user
+ * buffer is bad. */
+static int read_user(struct fdesc *desc, const struct iovec *iov, int iovcnt,
+		off_t ofs)
+{
+	int64_t total = iov_total(iov, iovcnt);
+	size_t cap;
+	if (total <= 0)
+		return total;
+	if (desc->pipe != NULL)
+		return pipe_user(desc, iov, iovcnt, false);
+	if (desc->kind == FD_SHM)
+		return -1;
+
+	char *bounce = bounce_alloc(total, &cap);
+	if (bounce == NULL)
+		return -1;
+
+	int done = 0;
+	while (done < total)
+	{
+		int chunk = total - done < (int64_t)cap ? total - done : (int64_t)cap;
+		int n = chunk;
+
+		if (desc->kind == FD_STDIN)
+		{
+			/* Whatever keys are waiting, after the first one unless
+			 * non-blocking.  A prompt still buffered goes out first. */
+			if (done == 0)
+				fd_flush(thread_current()->fd_table);
+			n = input_read((uint8_t *)bounce, chunk,
+					done == 0 && !(desc->flags & O_NONBLOCK));
+			if (n == 0 && done == 0)
+			{
+				palloc_free_multiple(bounce, cap / PGSIZE);
+				return -1;
+			}
+		}
+		else
+		{
+			lock_acquire(&filesys_lock);
+			if (ofs < 0)
+				n = file_read(desc->file, bounce, chunk);
+			else
+				n = file_read_at(desc->file, bounce, chunk, ofs + done);
+			lock_release(&filesys_lock);
+		}
+
+		if (!iov_copy(iov, done, bounce, n, true))
+		{
+			palloc_free_multiple(bounce, cap / PGSIZE);
+			syscall_exit(-1);
+		}
+		done += n;
+		if (n < chunk)
+			break;
+	}
+	palloc_free_multiple(bounce, cap / PGSIZE);
+	return done;
+}
+
+/* Writes the IOVCNT user buffers in IOV to DESC, at offset OFS, or at
+ * the file position if OFS is negative.  Returns the number of bytes
+ * written, or -1 on failure.  Terminates the process if a user buffer
+ * is bad. */
+static int write_user(struct fdesc *desc, const struct iovec *iov, int iovcnt,
+		off_t ofs)
+{
+	int64_t total = iov_total(iov, iovcnt);
+	size_t cap;
+	if (total <= 0)
+		return total;
+	if (desc->pipe != NULL)
+		return pipe_user(desc, iov, iovcnt, true);
+	if (desc->kind == FD_SHM)
+		return -1;
+
+	char *bounce = bounce_alloc(total, &cap);
+	if (bounce == NULL)
+		return -1;
+
+	int done = 0;
+	while (done < total)
+	{
+		int chunk = total - done < (int64_t)cap ? total - done : (int64_t)cap;
+		int n = chunk;
+
+		if (!iov_copy(iov, done, bounce, chunk, false))
+		{
+			palloc_free_multiple(bounce, cap / PGSIZE);
+			syscall_exit(-1);
+		}
+
+		if (desc->kind == FD_STDOUT && desc->out != NULL)
+			stdout_write(desc->out, bounce, chunk);
+		else if (desc->kind == FD_STDOUT)
+			putbuf(bounce, chunk);
+		else
+		{
+			lock_acquire(&filesys_lock);
+			if (ofs < 0)
+				n = file_write(desc->file, bounce, chunk);
+			else
+				n = file_write_at(desc->file, bounce, chunk, ofs + done);
+			lock_release(&filesys_lock);
+		}
+		done += n;
+		if (n < chunk)
+			break;
+	}
+	palloc_free_multiple(bounce, cap / PGSIZE);
+	return done;
+}
+
+/* Copies IOVCNT iovecs from user address UIOV into DST, which has room
+ * for IOV_MAX of them.  Returns false if IOVCNT is out of range, and
+ * terminates the process if UIOV is bad. */
+static bool copy_in_iovec(struct iovec *dst, const struct iovec *uiov,
+		int iovcnt)
+{
+	if (iovcnt < 0 || iovcnt > IOV_MAX)
+		return false;
+	if (!copy_from_user(dst, uiov, iovcnt * sizeof *dst))
+		syscall_exit(-1);
+	return true;
+}
+
+/* Returns the description behind FD in the current process, or a null
+ * pointer if FD is not open.  The caller may use it until put_desc(),
+ * even if another thread closes FD meanwhile.  If the process exits
+ * first, process_exit() lets go of it. */
+static struct fdesc *get_desc(int fd)
+{
+	struct thread *curr = thread_current();
+
+	ASSERT(curr->fd_held == NULL);
+	curr->fd_held = fd_get(curr->fd_table, fd);
+	return curr->fd_held;
+}
+
+/* Lets go of the description get_desc() returned, if any. */
+static void put_desc(void)
+{
+	struct thread *curr = thread_current();
+
+	if (curr->fd_held != NULL)
+	{
+		fd_put(curr->fd_table, curr->fd_held);
+		curr->fd_held = NULL;
+	}
+}
+/* Returns the poll() events pending on DESC.  Unless P is null, also
+ * hooks P through E onto what DESC refers to, to be woken when that
+ * changes. */
+static int desc_poll(struct fdesc *desc, struct poller *p,
+		struct waitq_entry *e)
+{
+	switch (desc->kind)
+	{
+	case FD_STDIN:
+		return input_poll(p, e) ? POLLIN : 0;
+	case FD_STDOUT:
+		return POLLOUT;
+	case FD_FILE:
+		/* Files never keep anyone waiting. */
+		return POLLIN | POLLOUT;
+	case FD_PIPE_READ:
+	case FD_PIPE_WRITE:
+		return pipe_poll(desc->pipe, desc->kind == FD_PIPE_WRITE, p, e);
+	default:
+		return 0;
+	}
+}
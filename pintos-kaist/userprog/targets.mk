@@ -1,6 +1,17 @@
-userprog_SRC  = userprog/process.c	# Process loading.
-userprog_SRC += userprog/exception.c	# User exception handler.
-userprog_SRC += userprog/syscall-entry.S # System call entry.
-userprog_SRC += userprog/syscall.c	# System call handler.
-userprog_SRC += userprog/gdt.c		# GDT initialization.
-userprog_SRC += userprog/tss.c		# TSS management.
+userprog_SRC  = userprog/process.c	# Process loading.
+userprog_SRC += userprog/exception.c	# User exception handler.
+userprog_SRC += userprog/syscall-entry.S # System call entry.
+userprog_SRC += userprog/syscall.c	# System call handler.
+userprog_SRC += userprog/fd.c		# File descriptor tables.
+userprog_SRC += userprog/pipe.c		# Pipes.
+userprog_SRC += userprog/stdout.c	# Buffered console output.
+userprog_SRC += userprog/shm.c		# Shared memory objects.
+userprog_SRC += userprog/uaccess.c	# User memory access.
+userprog_SRC += userprog/ring.c		# Batched system call rings.
+userprog_SRC += userprog/vdso.c		# Kernel data pages for processes.
+userprog_SRC += userprog/exec_cache.c	# Executable image cache.
+userprog_SRC += userprog/heap.c		# Process heaps for brk() and sbrk().
+userprog_SRC += userprog/uthread.c	# Threads sharing a process.
+userprog_SRC += userprog/futex.c	# Futex wait queues.
+userprog_SRC += userprog/gdt.c		# GDT initialization.
+userprog_SRC += userprog/tss.c		# TSS management.
@@ -0,0 +1,125 @@
+#include "userprog/uaccess.h"
+#include <debug.h>
+#include "intrinsic.h"
+#include "threads/interrupt.h"
+#include "threads/vaddr.h"
+
+/* Access to user memory from the kernel.
+ *
+ * These routines dereference user addresses directly instead of
+ * walking the page tables first.  Each instruction that may touch user
+ * memory has an entry in the __ex_table section giving the address to
+ * resume at if it faults.  page_fault() first lets the VM system try to
+ * bring the page in, and only if that fails calls uaccess_fixup(),
+ * which redirects the faulting kernel instruction to its fixup.  The
+ * only checks left before an access are that the range lies below
+ * KERN_BASE, since a kernel address would not fault, and that it does
+ * not wrap around. */
+
+#define CR0_WP (1 << 16)            /* Supervisor write protect. */
+
+/* One exception table entry. */
+struct ex_entry {
+	uintptr_t insn;             /* Instruction that may fault. */
+	uintptr_t fixup;            /* Where to continue if it does. */
+};
+
+/* Bounds of the exception table, from kernel.lds.S. */
+extern const struct ex_entry __start___ex_table[], __stop___ex_table[];
+
+/* Makes the kernel honor read-only user pages, which it ignores
+ * otherwise, so that copy_to_user() into one faults and fails, or
+ * breaks copy-on-write, as a store from user mode would. */
+void
+uaccess_init (void) {
+	lcr0 (rcr0 () | CR0_WP);
+}
+
+/* Returns true if [UADDR, UADDR + SIZE) lies in user space. */
+static bool
+is_user_range (const void *uaddr, size_t size) {
+	uintptr_t start = (uintptr_t) uaddr;
+	return start + size >= start && start + size <= KERN_BASE;
+}
+
+/* Copies SIZE bytes from SRC to DST with a single rep movsb, which
+ * leaves the count of bytes not yet copied in rcx when it faults.
+ * Returns that count, which is 0 on success. */
+static size_t
+user_copy (void *dst, const void *src, size_t size) {
+	asm volatile ("1: rep movsb\n"
+	              "2:\n"
+	              ".pushsection __ex_table, \"a\"\n"
+	              "   .quad 1b, 2b\n"
+	              ".popsection"
+	              : "+D" (dst), "+S" (src), "+c" (size)
+	              : : "memory");
+	return size;
+}
+
+/* Reads the byte at user address UADDR into *DST.  Returns false if
+ * UADDR is not mapped. */
+static inline bool
+get_user (char *dst, const char *uaddr) {
+	int fault = 0;
+	char byte;
+
+	asm volatile ("1: movb %2, %1\n"
+	              "2:\n"
+	              ".pushsection .fixup, \"ax\"\n"
+	              "3: movl $1, %0\n"
+	              "   jmp 2b\n"
+	              ".popsection\n"
+	              ".pushsection __ex_table, \"a\"\n"
+	              "   .quad 1b, 3b\n"
+	              ".popsection"
+	              : "+r" (fault), "=q" (byte)
+	              : "m" (*uaddr));
+	*dst = byte;
+	return !fault;
+}
+
+/* Copies SIZE bytes from user address USRC to DST.  Returns false if
+ * any part of the source is not readable user memory, in which case
+ * DST may have been partly written. */
+bool
+copy_from_user (void *dst, const void *usrc, size_t size) {
+	return is_user_range (usrc, size) && user_copy (dst, usrc, size) == 0;
+}
+
+/* Copies SIZE bytes from SRC to user address UDST.  Returns false if
+ * any part of the destination is not writable user memory. */
+bool
+copy_to_user (void *udst, const void *src, size_t size) {
+	return is_user_range (udst, size) && user_copy (udst, src, size) == 0;
+}
+
+/* Copies the null-terminated string at user address USRC into DST,
+ * which has room for SIZE bytes including the null terminator.
+ * Returns the length of the string, or -1 if it runs into memory that
+ * is not readable user memory.  If the string does not fit, returns
+ * SIZE and leaves DST unterminated. */
+int64_t
+strncpy_from_user (char *dst, const char *usrc, size_t size) {
+	for (size_t i = 0; i < size; i++) {
+		if (!is_user_vaddr (usrc + i) || !get_user (&dst[i], usrc + i))
+			return -1;
+		if (dst[i] == '\0')
+			return i;
+	}
+	return size;
+}
+
+/* Called by page_fault() for a kernel-mode fault that the VM system
+ * could not resolve.  If the faulting instruction is one of the user
+ * accesses above, resumes F at its fixup and returns true. */
+bool
+uaccess_fixup (struct intr_frame *f) {
+	for (const struct ex_entry *e = __start___ex_table;
+			e < __stop___ex_table; e++)
+		if (e->insn == f->rip) {
+			f->rip = e->fixup;
+			return true;
+		}
+	return false;
+}
@@ -0,0 +1,469 @@
+#include "userprog/uthread.h"
+#include <debug.h>
+#include <list.h>
+#include <string.h>
+#include "threads/flags.h"
+#include "threads/interrupt.h"
+#include "threads/malloc.h"
+#include "threads/mmu.h"
+#include "threads/palloc.h"
+#include "threads/synch.h"
+#include "threads/waitq.h"
+#include "userprog/futex.h"
+#include "userprog/gdt.h"
+#include "userprog/process.h"
+#include "userprog/syscall.h"
+
+/* User threads.
+ *
+ * uthread_spawn() starts another thread in the current process: a
+ * kernel thread that runs user code on the process's page tables and
+ * descriptor table, on a user stack of its own.  The first thread of
+ * a process to spawn one becomes the leader of a thread group, which
+ * every thread of the process points to.  The leader owns what the
+ * threads share, the page tables, descriptors, heap, executable and
+ * exit record, and does not give any of it up before the other
+ * threads are gone.
+ *
+ * The other threads' stacks take fixed slots of UTHREAD_STACK_SIZE
+ * bytes below the leader's stack.  Like the heap's, their pages are
+ * allocated on first touch, except the lowest page of each slot,
+ * which stays unmapped to catch overflows, and they are freed when
+ * the thread exits.
+ *
+ * exit() from any thread ends the whole process: the first thread to
+ * call it sets the exit status and marks the group killed, and every
+ * other thread exits quietly on its way back to user mode, from a
+ * system call or an interrupt, woken first if it sleeps on a futex
+ * or in poller_wait(), as pipes, console input and poll() do.  A
+ * thread whose function returns ends only itself, except that the
+ * leader first waits for the others and then exits the process.
+ *
+ * The group lock protects the group and serializes every change to
+ * the shared page tables: page faults, brk(), shared memory, rings,
+ * pipes' page flipping and thread stacks, and fork()'s walk of them.
+ * User memory must not be touched with it held, since a fault there
+ * takes it too. */
+
+/* A thread other than the leader, as thread_join() sees it. */
+struct uthread_rec {
+	struct list_elem elem;          /* Element in group's threads. */
+	tid_t tid;                      /* Thread identifier. */
+	int status;                     /* Exit status, once DONE is up. */
+	int slot;                       /* Stack slot. */
+	struct semaphore done;          /* Upped when the thread exits. */
+};
+
+struct uthread_group {
+	struct lock lock;               /* Protects the members below. */
+	struct thread *leader;          /* Owner of the process. */
+	struct list threads;            /* Records not joined yet. */
+	struct list members;            /* Running threads besides LEADER. */
+	int live;                       /* Threads running besides LEADER. */
+	struct condition changed;       /* Signaled when LIVE drops to 0
+	                                   and when KILLED is set. */
+	uint32_t slots;                 /* Bitmap of stack slots in use. */
+	bool killed;                    /* Has a thread called exit()? */
+	int exit_status;                /* Process's exit status, if KILLED. */
+};
+
+/* What uthread_spawn() hands to the new thread.  Lives on the
+ * spawning thread's stack until the new thread ups STARTED. */
+struct start_info {
+	struct uthread_group *group;    /* Group to join. */
+	struct uthread_rec *rec;        /* New thread's record. */
+	void *entry;                    /* User code to start at. */
+	void *func;                     /* First argument for ENTRY. */
+	void *aux;                      /* Second argument for ENTRY. */
+	struct semaphore started;       /* Upped once the thread is set up. */
+};
+
+#ifndef VM
+static struct uthread_group *group_get (struct thread *);
+static void uthread_start (void *);
+#endif
+static void group_free (struct uthread_group *);
+static uint8_t *slot_top (int slot);
+
+/* Starts a thread in the current process that enters user mode at
+ * ENTRY with FUNC and AUX as its two arguments.  Returns its thread
+ * id, or TID_ERROR if the process is exiting or already runs
+ * UTHREAD_MAX other threads, or if memory is exhausted. */
+tid_t
+uthread_spawn (void *entry UNUSED, void *func UNUSED, void *aux UNUSED) {
+#ifdef VM
+	/* The supplemental page table lives in struct thread, so another
+	 * thread would not see the process's pages. */
+	return TID_ERROR;
+#else
+	struct thread *curr = thread_current ();
+	struct uthread_group *g = group_get (curr);
+	struct start_info info;
+	struct uthread_rec *rec;
+	tid_t tid;
+
+	if (g == NULL || (rec = malloc (sizeof *rec)) == NULL)
+		return TID_ERROR;
+	rec->status = -1;
+	sema_init (&rec->done, 0);
+
+	lock_acquire (&g->lock);
+	if (g->killed || ~g->slots == 0) {
+		lock_release (&g->lock);
+		free (rec);
+		return TID_ERROR;
+	}
+	rec->slot = __builtin_ctz (~g->slots);
+	g->slots |= 1u << rec->slot;
+	g->live++;
+	lock_release (&g->lock);
+
+	info.group = g;
+	info.rec = rec;
+	info.entry = entry;
+	info.func = func;
+	info.aux = aux;
+	sema_init (&info.started, 0);
+	tid = thread_create (curr->name, PRI_DEFAULT, uthread_start, &info);
+	if (tid == TID_ERROR) {
+		lock_acquire (&g->lock);
+		g->slots &= ~(1u << rec->slot);
+		if (--g->live == 0)
+			cond_broadcast (&g->changed, &g->lock);
+		lock_release (&g->lock);
+		free (rec);
+		return TID_ERROR;
+	}
+	sema_down (&info.started);
+	return tid;
+#endif
+}
+
+/* Waits for thread TID of the current process to exit and returns
+ * its exit status.  Returns -1 at once if TID is not a thread of the
+ * current process other than its leader and the caller, or if it has
+ * been joined already. */
+int
+uthread_join (tid_t tid) {
+	struct thread *curr = thread_current ();
+	struct uthread_group *g = curr->group;
+	struct uthread_rec *rec = NULL;
+	struct list_elem *e;
+	int status;
+
+	if (g == NULL || tid == curr->tid)
+		return -1;
+	lock_acquire (&g->lock);
+	for (e = list_begin (&g->threads); e != list_end (&g->threads);
+			e = list_next (e)) {
+		struct uthread_rec *r = list_entry (e, struct uthread_rec, elem);
+		if (r->tid == tid) {
+			rec = r;
+			list_remove (&r->elem);
+			break;
+		}
+	}
+	lock_release (&g->lock);
+	if (rec == NULL)
+		return -1;
+
+	sema_down (&rec->done);
+	status = rec->status;
+	free (rec);
+	return status;
+}
+
+/* Ends the current thread with STATUS.  The leader waits for the
+ * other threads first, then exits the process. */
+void
+uthread_end (int status) {
+	struct thread *curr = thread_current ();
+	struct uthread_group *g = curr->group;
+
+	if (g != NULL && curr != g->leader) {
+		curr->exit_status = status;
+		thread_exit ();
+	}
+	if (g != NULL) {
+		lock_acquire (&g->lock);
+		while (g->live > 0 && !g->killed)
+			cond_wait (&g->changed, &g->lock);
+		lock_release (&g->lock);
+		uthread_check_killed ();
+	}
+	syscall_exit (status);
+	NOT_REACHED ();
+}
+
+/* Makes T, which is calling exit(), end its whole process.  Returns
+ * true if T's exit status becomes the process's.  Returns false if
+ * another thread got there first, after setting T's exit status to
+ * the one that thread chose. */
+bool
+uthread_kill (struct thread *t) {
+	struct uthread_group *g = t->group;
+	bool first;
+
+	if (g == NULL)
+		return true;
+	lock_acquire (&g->lock);
+	first = !g->killed;
+	if (first) {
+		struct list_elem *e;
+
+		g->killed = true;
+		g->exit_status = t->exit_status;
+		cond_broadcast (&g->changed, &g->lock);
+
+		/* Wake up the other threads wherever they sleep in
+		 * poller_wait(). */
+		if (g->leader != t)
+			poller_interrupt (g->leader);
+		for (e = list_begin (&g->members); e != list_end (&g->members);
+				e = list_next (e)) {
+			struct thread *m = list_entry (e, struct thread, group_elem);
+			if (m != t)
+				poller_interrupt (m);
+		}
+	} else
+		t->exit_status = g->exit_status;
+	lock_release (&g->lock);
+	if (first)
+		futex_interrupt (g);
+	return first;
+}
+
+/* Returns true if another thread is exiting T's process. */
+bool
+uthread_killed (const struct thread *t) {
+	return t->group != NULL && t->group->killed;
+}
+
+/* Ends the current thread, which is about to return to user mode, if
+ * another thread is exiting its process. */
+void
+uthread_check_killed (void) {
+	struct thread *curr = thread_current ();
+	struct uthread_group *g = curr->group;
+
+	if (g != NULL && g->killed) {
+		curr->exit_status = g->exit_status;
+		intr_enable ();
+		thread_exit ();
+	}
+}
+
+/* Takes T, which is exiting, out of its process's threads.  The
+ * leader, or a thread that never spawned any, gets true back once it
+ * is the only thread left, and then has the process's resources to
+ * free.  Any other thread gets false, and no longer refers to them. */
+bool
+uthread_leave (struct thread *t) {
+	struct uthread_group *g = t->group;
+	struct uthread_rec *rec = t->join_rec;
+	uint8_t *upage;
+	struct tlb_batch batch;
+
+	if (g == NULL)
+		return true;
+	if (t == g->leader) {
+		/* Killed some other way than exit(), say by an exception. */
+		uthread_kill (t);
+		lock_acquire (&g->lock);
+		while (g->live > 0)
+			cond_wait (&g->changed, &g->lock);
+		lock_release (&g->lock);
+		group_free (g);
+		t->group = NULL;
+		return true;
+	}
+
+	lock_acquire (&g->lock);
+	tlb_batch_begin (&batch, t->pml4);
+	for (upage = slot_top (rec->slot) - UTHREAD_STACK_SIZE;
+			upage < slot_top (rec->slot); upage += PGSIZE)
+		pml4_release_page (t->pml4, upage);
+	tlb_batch_flush (&batch);
+	g->slots &= ~(1u << rec->slot);
+	list_remove (&t->group_elem);
+
+	/* As in process_cleanup(), switch away before letting go. */
+	t->pml4 = NULL;
+	pml4_activate (NULL);
+	t->fd_table = NULL;
+	t->group = NULL;
+	t->join_rec = NULL;
+
+	/* A joiner may free REC as soon as it is up. */
+	rec->status = t->exit_status;
+	sema_up (&rec->done);
+	if (--g->live == 0)
+		cond_broadcast (&g->changed, &g->lock);
+	lock_release (&g->lock);
+	return false;
+}
+
+/* Returns true if T's process runs no thread besides T, leaving T as
+ * if it had never spawned any. */
+bool
+uthread_single (struct thread *t) {
+	struct uthread_group *g = t->group;
+	bool alone;
+
+	if (g == NULL)
+		return true;
+	if (t != g->leader)
+		return false;
+	lock_acquire (&g->lock);
+	alone = g->live == 0;
+	lock_release (&g->lock);
+	if (alone) {
+		group_free (g);
+		t->group = NULL;
+	}
+	return alone;
+}
+
+/* Returns the thread that owns T's process: its leader, or T itself
+ * if it is the only thread. */
+struct thread *
+uthread_leader (struct thread *t) {
+	return t->group != NULL ? t->group->leader : t;
+}
+
+/* Serializes changes to, and walks of, the page tables of T's process
+ * with those of its other threads, if it has any, until
+ * uthread_mm_release().  T is the current thread, or a thread that
+ * stays in its process meanwhile, such as a parent blocked in fork(). */
+void
+uthread_mm_acquire (struct thread *t) {
+	struct uthread_group *g = t->group;
+	if (g != NULL)
+		lock_acquire (&g->lock);
+}
+
+/* Ends what uthread_mm_acquire(T) started. */
+void
+uthread_mm_release (struct thread *t) {
+	struct uthread_group *g = t->group;
+	if (g != NULL)
+		lock_release (&g->lock);
+}
+
+/* Handles a fault at VA, in user space, on a page that is not
+ * present, with uthread_mm_acquire() in effect.  If VA lies in the
+ * stack of one of the current process's threads, below its guard
+ * page, makes sure a zeroed page is mapped there and returns true.
+ * Returns false otherwise, or if memory is exhausted. */
+bool
+uthread_stack_fault (const void *va) {
+	struct thread *curr = thread_current ();
+	struct uthread_group *g = curr->group;
+	uint8_t *upage = pg_round_down (va);
+	void *kpage;
+	int slot;
+
+	if (g == NULL || curr->pml4 == NULL || upage < UTHREAD_STACKS_BOTTOM
+			|| upage >= UTHREAD_STACKS_TOP)
+		return false;
+	slot = (UTHREAD_STACKS_TOP - 1 - upage) / UTHREAD_STACK_SIZE;
+	if ((g->slots & (1u << slot)) == 0
+			|| upage == slot_top (slot) - UTHREAD_STACK_SIZE)
+		return false;
+
+	/* Another thread may have faulted it in first. */
+	if (pml4_get_page (curr->pml4, upage) != NULL)
+		return true;
+	kpage = palloc_get_page (PAL_USER | PAL_ZERO);
+	if (kpage == NULL)
+		return false;
+	if (!pml4_set_page (curr->pml4, upage, kpage, true)) {
+		palloc_free_page (kpage);
+		return false;
+	}
+	return true;
+}
+
+#ifndef VM
+/* Returns T's group, setting one up with T as its leader if T has
+ * none yet.  Returns a null pointer if memory is exhausted. */
+static struct uthread_group *
+group_get (struct thread *t) {
+	struct uthread_group *g = t->group;
+
+	if (g != NULL)
+		return g;
+	g = malloc (sizeof *g);
+	if (g == NULL)
+		return NULL;
+	lock_init (&g->lock);
+	g->leader = t;
+	list_init (&g->threads);
+	list_init (&g->members);
+	g->live = 0;
+	cond_init (&g->changed);
+	g->slots = 0;
+	g->killed = false;
+	g->exit_status = 0;
+	t->group = g;
+	return g;
+}
+#endif
+
+/* Frees G, whose threads besides its leader have all exited. */
+static void
+group_free (struct uthread_group *g) {
+	ASSERT (g->live == 0);
+	while (!list_empty (&g->threads))
+		free (list_entry (list_pop_front (&g->threads),
+					struct uthread_rec, elem));
+	free (g);
+}
+
+#ifndef VM
+/* A thread function that starts a thread for uthread_spawn(). */
+static void
+uthread_start (void *info_) {
+	struct start_info *info = info_;
+	struct uthread_group *g = info->group;
+	struct thread *curr = thread_current ();
+	struct intr_frame if_;
+
+	curr->group = g;
+	curr->join_rec = info->rec;
+	curr->pml4 = g->leader->pml4;
+	curr->fd_table = g->leader->fd_table;
+	process_activate (curr);
+
+	memset (&if_, 0, sizeof if_);
+	if_.ds = if_.es = if_.ss = SEL_UDSEG;
+	if_.cs = SEL_UCSEG;
+	if_.eflags = FLAG_IF | FLAG_MBS;
+	if_.rip = (uintptr_t) info->entry;
+	if_.R.rdi = (uintptr_t) info->func;
+	if_.R.rsi = (uintptr_t) info->aux;
+	/* As if ENTRY had been called: its return address is the 0 that
+	 * the untouched stack page reads as. */
+	if_.rsp = (uintptr_t) slot_top (info->rec->slot) - sizeof (void *);
+
+	lock_acquire (&g->lock);
+	info->rec->tid = curr->tid;
+	list_push_back (&g->threads, &info->rec->elem);
+	list_push_back (&g->members, &curr->group_elem);
+	/* Killed before it could be found and interrupted. */
+	if (g->killed)
+		poller_interrupt (curr);
+	lock_release (&g->lock);
+
+	/* INFO lives on the spawning thread's stack: done with it. */
+	sema_up (&info->started);
+	do_iret (&if_);
+	NOT_REACHED ();
+}
+#endif
+
+/* Returns the top of stack slot SLOT. */
+static uint8_t *
+slot_top (int slot) {
+	return UTHREAD_STACKS_TOP - slot * UTHREAD_STACK_SIZE;
+}
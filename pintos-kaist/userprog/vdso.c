@@ -0,0 +1,76 @@
+#include "userprog/vdso.h"
+#include <debug.h>
+#include <vdso.h>
+#include "devices/timer.h"
+#include "threads/mmu.h"
+#include "threads/palloc.h"
+#include "threads/synch.h"
+#include "threads/thread.h"
+#include "threads/vaddr.h"
+#include "intrinsic.h"
+
+/* Kernel side of the pages in lib/vdso.h.  The time page is a single
+ * kernel-pool frame that every process maps with
+ * pml4_set_shared_page(), so tearing down a process leaves it alone.
+ * The process page comes from the user pool and goes away with the
+ * process's page tables like any other user page. */
+
+static struct vdso_time *vdso_time;
+
+/* Allocates the time page.  Called once at boot; until then the
+ * timer does not update it and no process maps it. */
+void
+vdso_init (void) {
+	vdso_time = palloc_get_page (PAL_ASSERT | PAL_ZERO);
+	vdso_time->freq = TIMER_FREQ;
+}
+
+/* Publishes the time of timer tick TICKS.  Called by the timer
+ * interrupt handler, so the update cannot itself be interrupted; the
+ * sequence count only protects user readers that are. */
+void
+vdso_tick (int64_t ticks) {
+	struct vdso_time *vt = vdso_time;
+	uint64_t tsc;
+
+	if (vt == NULL)
+		return;
+	tsc = rdtsc ();
+
+	vt->seq++;
+	barrier ();
+	/* A running average smooths out interrupt latency. */
+	if (vt->tsc != 0) {
+		uint64_t delta = tsc - vt->tsc;
+		vt->tsc_per_tick = vt->tsc_per_tick == 0
+			? delta : (vt->tsc_per_tick * 7 + delta) / 8;
+	}
+	vt->ticks = ticks;
+	vt->tsc = tsc;
+	barrier ();
+	vt->seq++;
+}
+
+/* Maps the vDSO pages into T's page tables, which must be empty in the
+ * vDSO range.  Returns false if memory is exhausted. */
+bool
+vdso_map (struct thread *t) {
+	struct vdso_proc *vp = palloc_get_page (PAL_USER | PAL_ZERO);
+
+	if (vp == NULL)
+		return false;
+	vp->pid = t->tid;
+	if (!pml4_set_page (t->pml4, (void *) VDSO_PROC_ADDR, vp, false)) {
+		palloc_free_page (vp);
+		return false;
+	}
+	return pml4_set_shared_page (t->pml4, (void *) VDSO_ADDR, vdso_time);
+}
+
+/* Returns true if UADDR lies in the vDSO pages, which fork() maps
+ * afresh instead of copying. */
+bool
+vdso_contains (const void *uaddr) {
+	uintptr_t a = (uintptr_t) uaddr;
+	return a >= VDSO_ADDR && a < VDSO_ADDR + VDSO_PAGES * PGSIZE;
+}